@@ -1,14 +1,45 @@
 ﻿#include "AIPlayer.hpp"
+#include "StrategyRegistry.hpp"
 #include <random>
+#include <stdexcept>
 #include <ctime>
 
 
 namespace Battleship {
-	AIPlayer::AIPlayer(std::string name, int boardSize)
-		: Player(name, boardSize)
+	AIPlayer::AIPlayer(std::string name, const FleetConfig& fleet, Difficulty difficulty)
+		: AIPlayer(name, fleet, difficulty, std::random_device()())
+	{
+	}
+
+	AIPlayer::AIPlayer(std::string name, const FleetConfig& fleet, Difficulty difficulty, std::uint32_t seed)
+		: AIPlayer(name, fleet, StrategyRegistry::Instance().GetPlacement("random"),
+			difficulty == Difficulty::eHard ? &StrategyRegistry::Instance().GetTargeting("density") : nullptr, seed)
+	{
+	}
+
+	AIPlayer::AIPlayer(std::string name, const FleetConfig& fleet, const PlacementStrategy& placement,
+		const TargetingStrategy& targeting, std::uint32_t seed)
+		: AIPlayer(name, fleet, placement, &targeting, seed)
+	{
+	}
+
+	AIPlayer::AIPlayer(std::string name, const FleetConfig& fleet, const PlacementStrategy& placement,
+		const TargetingStrategy* targeting, std::uint32_t seed)
+		: Player(name, fleet)
 		, m_lastHit({ -1, -1 })
+		, m_placement(&placement)
+		, m_targeting(targeting)
+		, m_view(fleet)
+		, m_gen(seed)
 	{
+		// Список ходов нужен только простому ИИ
+		if (m_targeting)
+		{
+			return;
+		}
+
 		// Генерируем все возможные ходы
+		const int boardSize = fleet.GetBoardSize();
 		for (int i = 0; i < boardSize; i++)
 		{
 			for (int j = 0; j < boardSize; j++)
@@ -18,68 +49,31 @@ namespace Battleship {
 		}
 
 		// Перемешиваем ходы
-		std::random_device rd;
-		std::mt19937 gen(rd());
-		std::shuffle(m_allPossibleMoves.begin(), m_allPossibleMoves.end(), gen);
+		std::shuffle(m_allPossibleMoves.begin(), m_allPossibleMoves.end(), m_gen);
 
-		shipSizes = GameBoard::MakeShipSizes(GameBoard::DEFAULT_SHIP_CONFIG);
+		m_movePositions.resize(m_allPossibleMoves.size());
+		for (size_t i = 0; i < m_allPossibleMoves.size(); i++)
+		{
+			const MoveType& move = m_allPossibleMoves[i];
+			m_movePositions[move.first * boardSize + move.second] = static_cast<int>(i);
+		}
 	}
 
 	void AIPlayer::PlaceShips()
 	{
-
-		std::random_device rd;
-		std::mt19937 gen(rd());
-
-		for (int size : shipSizes)
+		if (!m_placement->PlaceFleet(m_myBoard, m_fleet, m_gen))
 		{
-			bool placed = false;
-			int attempts = 0;
-
-			while (!placed && attempts < MAX_ATEMPTS) // Ограничение на попытки
-			{
-				int row = gen() % m_myBoard.GetSize();
-				int col = gen() % m_myBoard.GetSize();
-				bool horizontal = gen() % 2 == 0;
-
-				Ship ship(size, { row, col }, horizontal);
-				placed = m_myBoard.PlaceShip(ship);
-				attempts++;
-			}
-
-			if (!placed)
-			{
-				// Если не удалось разместить, пробуем альтернативный алгоритм
-				placed = PlaceShipAlternative(size, gen);
-			}
+			throw std::runtime_error("Fleet does not fit on the board");
 		}
 	}
 
-	bool AIPlayer::PlaceShipAlternative(int size, std::mt19937& gen)
+	Player::MoveType AIPlayer::MakeMove()
 	{
-		// Альтернативный алгоритм размещения корабля
-		for (int attempt = 0; attempt < MAX_ATEMPTS; attempt++)
+		if (m_targeting)
 		{
-			for (bool horizontal : {true, false})
-			{
-				for (int row = 0; row < m_myBoard.GetSize(); row++)
-				{
-					for (int col = 0; col < m_myBoard.GetSize(); col++)
-					{
-						Ship ship(size, { row, col }, horizontal);
-						if (m_myBoard.PlaceShip(ship))
-						{
-							return true;
-						}
-					}
-				}
-			}
+			return m_targeting->SelectShot(m_view, m_gen);
 		}
-		return false;
-	}
 
-	Player::MoveType AIPlayer::MakeMove()
-	{
 		// Если есть потенциальные цели, стреляем в них
 		if (!m_potentialTargets.empty())
 		{
@@ -91,9 +85,7 @@ namespace Battleship {
 		// Иначе стреляем в случайную клетку из доступных
 		if (!m_allPossibleMoves.empty())
 		{
-			MoveType move = m_allPossibleMoves.back();
-			m_allPossibleMoves.pop_back();
-			return move;
+			return TakeMove();
 		}
 
 		// Запасной вариант
@@ -102,6 +94,12 @@ namespace Battleship {
 
 	void AIPlayer::UpdateAIState(Ship::ShotResult result, MoveType coord)
 	{
+		if (m_targeting)
+		{
+			m_view.Update(result, coord);
+			return;
+		}
+
 		if (result == Ship::ShotResult::eHit)
 		{
 			m_lastHit = coord;
@@ -119,11 +117,9 @@ namespace Battleship {
 					MoveType newTarget = { newRow, newCol };
 
 					// Проверяем, что этот ход еще возможен
-					auto it = std::find(m_allPossibleMoves.begin(), m_allPossibleMoves.end(), newTarget);
-					if (it != m_allPossibleMoves.end())
+					if (RemoveMove(newTarget))
 					{
 						m_potentialTargets.push_back(newTarget);
-						m_allPossibleMoves.erase(it);
 					}
 				}
 			}
@@ -135,4 +131,29 @@ namespace Battleship {
 			m_lastHit = { -1, -1 };
 		}
 	}
+
+	bool AIPlayer::RemoveMove(MoveType move)
+	{
+		int& position = m_movePositions[move.first * m_myBoard.GetSize() + move.second];
+		if (position < 0)
+		{
+			return false;
+		}
+
+		// Удаление обменом с последним: порядок остальных ходов остаётся случайным
+		MoveType last = m_allPossibleMoves.back();
+		m_allPossibleMoves[position] = last;
+		m_movePositions[last.first * m_myBoard.GetSize() + last.second] = position;
+		m_allPossibleMoves.pop_back();
+		position = -1;
+		return true;
+	}
+
+	Player::MoveType AIPlayer::TakeMove()
+	{
+		MoveType move = m_allPossibleMoves.back();
+		m_allPossibleMoves.pop_back();
+		m_movePositions[move.first * m_myBoard.GetSize() + move.second] = -1;
+		return move;
+	}
 }
\ No newline at end of file
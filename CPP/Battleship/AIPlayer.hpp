@@ -2,15 +2,24 @@
 
 #include "Player.hpp"
 #include "GameBoard.hpp"
+#include "BoardView.hpp"
+#include "Strategy.hpp"
+#include "RandomEngine.hpp"
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <cstdint>
 
 namespace Battleship {
 	class AIPlayer : public Player
 	{
 	public:
-		static const int MAX_ATEMPTS = 100;
+		// eEasy - случайные выстрелы и обстрел соседей попадания, eHard - стратегия "density"
+		enum class Difficulty
+		{
+			eEasy = 0,
+			eHard = 1
+		};
 
 		// публичные: переопределение типом
 		using TargetsType = std::vector<MoveType>;
@@ -18,20 +27,35 @@ namespace Battleship {
 
 	public:
 		// конструкторы и деконструктор
-		AIPlayer(std::string name, int boardSize);
+		AIPlayer(std::string name, const FleetConfig& fleet, Difficulty difficulty = Difficulty::eHard);
+		AIPlayer(std::string name, const FleetConfig& fleet, Difficulty difficulty, std::uint32_t seed);
+		AIPlayer(std::string name, const FleetConfig& fleet, const PlacementStrategy& placement,
+			const TargetingStrategy& targeting, std::uint32_t seed);
 		~AIPlayer() override = default;
 
 		// публичные методы
 		void PlaceShips() override;
 		MoveType MakeMove() override;
+		void OnShotResult(Ship::ShotResult result, MoveType move) override { UpdateAIState(result, move); }
 		void UpdateAIState(Ship::ShotResult result, MoveType coord);
-		bool PlaceShipAlternative(int size, std::mt19937& gen);
 
 	private:
+		// конструкторы: targeting = nullptr - простой ИИ уровня eEasy
+		AIPlayer(std::string name, const FleetConfig& fleet, const PlacementStrategy& placement,
+			const TargetingStrategy* targeting, std::uint32_t seed);
+
+		// приватные методы
+		bool RemoveMove(MoveType move);
+		MoveType TakeMove();
+
 		// приватные переменные
 		MoveType m_lastHit;
 		TargetsType m_potentialTargets;
-		MovesType m_allPossibleMoves;
-		GameBoard::ShipSizesType shipSizes;
+		MovesType m_allPossibleMoves;		// ещё не сделанные ходы в случайном порядке
+		std::vector<int> m_movePositions;	// индекс клетки (row * size + col) в m_allPossibleMoves или -1
+		const PlacementStrategy* m_placement;
+		const TargetingStrategy* m_targeting;
+		BoardView m_view;
+		RandomEngine m_gen;
 	};
 }
\ No newline at end of file
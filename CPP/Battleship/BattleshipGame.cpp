@@ -2,12 +2,14 @@
 
 namespace Battleship {
 
-	GameManager::GameManager(int boardSize)
+	GameManager::GameManager(const FleetConfig& fleet, const std::string& placement, const std::string& targeting)
 		: m_gameOver(false)
 		, m_userInterface(new UserInterface(this))
 	{
-		m_player1 = new HumanPlayer("Игрок 1", boardSize);
-		m_player2 = new AIPlayer("Компьютер", boardSize);
+		const StrategyRegistry& registry = StrategyRegistry::Instance();
+		m_player1 = new HumanPlayer("Игрок 1", fleet);
+		m_player2 = new AIPlayer("Компьютер", fleet, registry.GetPlacement(placement),
+			registry.GetTargeting(targeting), std::random_device()());
 
 		m_currentPlayer = m_player1;
 
@@ -23,30 +25,20 @@ namespace Battleship {
 		delete m_userInterface;
 	}
 
-	void GameManager::StartGame() {
+	void GameManager::StartGame(const FleetConfig& fleet) {
 
 		while (true) {
 			// Устанавливаем локаль для поддержки русского языка
 			setlocale(LC_ALL, "Russian");
 
-			std::cout << "========================================\n";
-			std::cout << "           МОРСКОЙ БОЙ\n";
-			std::cout << "========================================\n";
-			std::cout << "Правила игры:\n";
-			std::cout << "- Расставьте корабли на поле 10x10\n";
-			std::cout << "- Корабли не могут касаться друг друга\n";
-			std::cout << "- Стандартный набор кораблей:\n";
-			std::cout << "  1 корабль - 4 клетки\n";
-			std::cout << "  2 корабля - 3 клетки\n";
-			std::cout << "  3 корабля - 2 клетки\n";
-			std::cout << "  4 корабля - 1 клетка\n";
-			std::cout << "- Вы можете выбрать ручную или автоматическую расстановку\n";
-			std::cout << "========================================\n\n";
+			PrintRules(fleet);
 
 			try
 			{
-				const int BOARD_SIZE = 10;
-				GameManager gameManager(BOARD_SIZE);
+				const StrategyRegistry& registry = StrategyRegistry::Instance();
+				std::string placement = ChooseStrategy("Расстановка кораблей компьютера", registry.GetPlacementNames());
+				std::string targeting = ChooseStrategy("Стрельба компьютера", registry.GetTargetingNames());
+				GameManager gameManager(fleet, placement, targeting);
 
 				// Настройка игры
 				gameManager.SetupGame();
@@ -112,31 +104,29 @@ namespace Battleship {
 			GameBoard* enemyBoard = m_currentPlayer->GetEnemyBoard();
 			Ship::ShotResult result = enemyBoard->ReceiveShot(move);
 
-			// Обновление состояния ИИ если нужно
-			if (aiPlayer)
-			{
-				aiPlayer->UpdateAIState(result, move);
-			}
+			// Игрок узнаёт результат своего выстрела
+			m_currentPlayer->OnShotResult(result, move);
 
 			// Отображение результата
-			std::cout << m_currentPlayer->GetName() << " стреляет в ("
-				<< move.first << ", " << move.second << ") - ";
+			std::string message = m_currentPlayer->GetName() + " стреляет в (" +
+				std::to_string(move.first) + ", " + std::to_string(move.second) + ") - ";
 
 			switch (result)
 			{
 			case Ship::ShotResult::eHit:
-				std::cout << "ПОПАДАНИЕ!\n";
+				message += "ПОПАДАНИЕ!";
 				break;
 			case Ship::ShotResult::eSunk:
-				std::cout << "КОРАБЛЬ ПОТОПЛЕН!\n";
+				message += "КОРАБЛЬ ПОТОПЛЕН!";
 				break;
 			case Ship::ShotResult::eMiss:
-				std::cout << "ПРОМАХ!\n";
+				message += "ПРОМАХ!";
 				break;
 			case Ship::ShotResult::eAlreadyShot:
-				std::cout << "Уже стреляли сюда!\n";
+				message += "Уже стреляли сюда!";
 				break;
 			}
+			m_userInterface->DisplayMessage(message);
 
 			// Показываем состояние после хода
 			if (!aiPlayer)
@@ -181,6 +171,46 @@ namespace Battleship {
 		}
 	}
 
+	void GameManager::PrintRules(const FleetConfig& fleet)
+	{
+		std::cout << "========================================\n";
+		std::cout << "           МОРСКОЙ БОЙ\n";
+		std::cout << "========================================\n";
+		std::cout << "Правила игры:\n";
+		fleet.Print(std::cout);
+		std::cout << "- Корабли не могут касаться друг друга\n";
+		std::cout << "- Вы можете выбрать ручную или автоматическую расстановку\n";
+		std::cout << "========================================\n\n";
+	}
+
+	std::string GameManager::ChooseStrategy(const std::string& title, const StrategyRegistry::NamesType& names)
+	{
+		std::cout << title << ":\n";
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			std::cout << i + 1 << " - " << names[i] << "\n";
+		}
+
+		int choice;
+		while (true)
+		{
+			std::cout << "Ваш выбор (1-" << names.size() << "): ";
+			std::cin >> choice;
+
+			if (std::cin.fail())
+			{
+				std::cin.clear();
+				std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+			}
+			else if (choice >= 1 && choice <= static_cast<int>(names.size()))
+			{
+				break;
+			}
+			std::cout << "Неверный выбор. Попробуйте снова.\n";
+		}
+		return names[choice - 1];
+	}
+
 	void GameManager::DisplayGameState()
 	{
 		std::cout << "\n";
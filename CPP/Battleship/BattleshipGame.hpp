@@ -4,6 +4,7 @@
 #include "HumanPlayer.hpp"
 #include "AIPlayer.hpp"
 #include "UserInterface.hpp"
+#include "StrategyRegistry.hpp"
 #include <windows.h>
 #include <fcntl.h>
 #include <io.h>
@@ -19,16 +20,22 @@ namespace Battleship {
 	{
 	public:
 		// конструкторы и деконструктор
-		GameManager(int boardSize);
+		GameManager(const FleetConfig& fleet, const std::string& placement = "random", const std::string& targeting = "density");
 		~GameManager();
 
 		// публичные методы
 		void SetupGame();
-		void StartGame();
+		void StartGame(const FleetConfig& fleet = FleetConfig());
 		void RunGameLoop();
 		void SwitchTurn();
 		void DisplayGameState();
 
+		// Правила игры для заданных поля и флота
+		static void PrintRules(const FleetConfig& fleet);
+
+		// Консольный выбор стратегии компьютера из списка реестра
+		static std::string ChooseStrategy(const std::string& title, const StrategyRegistry::NamesType& names);
+
 		// геттеры
 		Player* GetCurrentPlayer() const { return m_currentPlayer; }
 		Player* GetPlayer1() const { return m_player1; }
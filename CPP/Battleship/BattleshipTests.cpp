@@ -0,0 +1,358 @@
+﻿#include "AIPlayer.hpp"
+#include "BoardView.hpp"
+#include "DensityTargeting.hpp"
+#include "FleetConfig.hpp"
+#include "FleetGenerator.hpp"
+#include "GameBoard.hpp"
+#include "GameRecord.hpp"
+#include "GameRecordWriter.hpp"
+#include "GameReplay.hpp"
+#include "MatchEngine.hpp"
+#include "StrategyRegistry.hpp"
+#include "TargetingStrategies.hpp"
+#include "Tournament.hpp"
+#include <chrono>
+#include <clocale>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Проверки движка "Морского боя" - отдельная консольная программа, как Battleship.exe;
+// собирается из этого файла и исходников движка (всё, кроме Main.cpp, Benchmark.cpp,
+// BattleshipGame.cpp, HumanPlayer.cpp, UserInterface.cpp и ConsoleRenderer.cpp).
+// Пишет временный файл записей в текущий каталог:
+//   BattleshipTests.exe    - код возврата 0, если все проверки прошли, иначе число провалов
+using namespace Battleship;
+
+namespace {
+	int failures = 0;
+
+	void Check(bool condition, const std::string& what)
+	{
+		if (!condition)
+		{
+			std::cerr << "  ПРОВАЛ: " << what << std::endl;
+			failures++;
+		}
+	}
+
+	FleetConfig LoadFleet(const std::string& text)
+	{
+		FleetConfig fleet;
+		std::istringstream in(text);
+		fleet.Load(in);
+		return fleet;
+	}
+
+	// Стрельба, нарушающая правила: всегда в левый верхний угол
+	class RepeatingTargeting : public TargetingStrategy
+	{
+	public:
+		std::string GetName() const override { return "repeating"; }
+		MoveType SelectShot(const BoardView&, RandomEngine&) const override { return { 0, 0 }; }
+	};
+
+	// Плотность перебором: для каждой клетки - места всех форм на плаву, которые её накрывают,
+	// не задевают закрытых клеток и не касаются чужих попаданий; при targeting - только накрывающие попадание
+	std::vector<int> CountPlacements(const BoardView& view, bool targeting)
+	{
+		const int size = view.GetSize();
+		std::vector<int> counts(size * size, 0);
+		for (size_t type = 0; type < view.GetRemaining().size(); type++)
+		{
+			const ShipShape& shape = view.GetFleet().GetShipType(static_cast<int>(type)).shape;
+			for (int orientation = 0; orientation < static_cast<int>(shape.GetOrientations().size()); orientation++)
+			{
+				const ShipShape::Orientation& variant = shape.GetOrientations()[orientation];
+				for (int r = 0; r + variant.height <= size; r++)
+				{
+					for (int c = 0; c + variant.width <= size; c++)
+					{
+						ShipShape::CellsType cells = shape.Place(orientation, r, c);
+						bool coversHit = false;
+						bool valid = true;
+						for (const auto& cell : cells)
+						{
+							coversHit = coversHit || view.GetHits().Test(cell.first, cell.second);
+							valid = valid && !view.GetBlocked().Test(cell.first, cell.second);
+						}
+						if (!valid || (targeting && !coversHit))
+						{
+							continue;
+						}
+
+						// Попадание рядом с местом, но не в нём, принадлежит другому кораблю
+						for (const auto& cell : cells)
+						{
+							for (int dr = -1; dr <= 1 && valid; dr++)
+							{
+								for (int dc = -1; dc <= 1 && valid; dc++)
+								{
+									std::pair<int, int> next = { cell.first + dr, cell.second + dc };
+									bool inside = false;
+									for (const auto& own : cells)
+									{
+										inside = inside || own == next;
+									}
+									valid = inside || next.first < 0 || next.second < 0 || next.first >= size || next.second >= size
+										|| !view.GetHits().Test(next.first, next.second);
+								}
+							}
+						}
+						for (const auto& cell : cells)
+						{
+							counts[cell.first * size + cell.second] += valid ? view.GetRemaining()[type] : 0;
+						}
+					}
+				}
+			}
+		}
+		return counts;
+	}
+
+	bool DensityMatches(const BoardView& view, bool targeting)
+	{
+		DensityTargeting::DensityType density;
+		DensityTargeting::ComputeDensity(view, targeting, density);
+		std::vector<int> counts = CountPlacements(view, targeting);
+		for (int row = 0; row < view.GetSize(); row++)
+		{
+			for (int col = 0; col < view.GetSize(); col++)
+			{
+				if (DensityTargeting::GetDensity(density, row, col) != counts[row * view.GetSize() + col])
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	void TestBoard()
+	{
+		GameBoard board(10);
+		Check(board.PlaceShip(Ship(2, { 0, 0 }, true)), "корабль ставится");
+		Check(!board.PlaceShip(Ship(1, { 1, 2 }, true)), "касающийся корабль не ставится");
+		Check(board.ReceiveShot({ 5, 5 }) == Ship::ShotResult::eMiss, "промах");
+		Check(board.ReceiveShot({ 0, 0 }) == Ship::ShotResult::eHit, "попадание");
+		Check(board.ReceiveShot({ 0, 0 }) == Ship::ShotResult::eAlreadyShot, "повторный выстрел");
+		Check(board.ReceiveShot({ 0, 1 }) == Ship::ShotResult::eSunk && board.IsAllShipsSunk(), "потопление");
+
+		bool rejected = false;
+		try
+		{
+			board.ReceiveShot({ 10, 0 });
+		}
+		catch (const std::out_of_range&)
+		{
+			rejected = true;
+		}
+		Check(rejected, "выстрел за поле отвергается");
+	}
+
+	void TestFleetGenerator()
+	{
+		FleetConfig fleet = LoadFleet("board;12\nship;1;###/.#.\nship;2;#./##\nship;2;###\nship;3;#\n");
+		FleetGenerator generator(fleet, 5);
+		int placed = 0;
+		for (int i = 0; i < 1000; i++)
+		{
+			// PlaceShip проверяет касания, так что успех - это корректная расстановка
+			GameBoard board(fleet.GetBoardSize());
+			placed += generator.PlaceFleet(board) && board.GetShips().size() == fleet.GetShips().size() ? 1 : 0;
+		}
+		Check(placed == 1000, "1000 расстановок без касаний");
+	}
+
+	void TestDensity()
+	{
+		// Состояния из настоящих партий: поиск и добивание на поле с фигурными кораблями
+		FleetConfig fleet = LoadFleet("board;10\nship;1;####\nship;1;#./##\nship;2;###\nship;2;##\nship;2;#\n");
+		FleetGenerator generator(fleet, 9);
+		const TargetingStrategy& targeting = StrategyRegistry::Instance().GetTargeting("density");
+		int states = 0;
+		bool matches = true;
+		for (int game = 0; game < 20 && matches; game++)
+		{
+			GameBoard board(fleet.GetBoardSize());
+			generator.PlaceFleet(board);
+			BoardView view(fleet);
+			RandomEngine random(game);
+			for (int shot = 0; !board.IsAllShipsSunk() && matches; shot++)
+			{
+				if (shot % 7 == 0)
+				{
+					matches = DensityMatches(view, false) && (!view.HasTargets() || DensityMatches(view, true));
+					states++;
+				}
+				BoardView::MoveType move = targeting.SelectShot(view, random);
+				view.Update(board.ReceiveShot(move), move);
+			}
+		}
+		Check(matches, "плотность совпадает с перебором (" + std::to_string(states) + " состояний)");
+
+		// Самое большое поле: счётчики не переполняются
+		BoardView large(LoadFleet("board;64\nship;100;#####/#..../#..../#....\nship;200;#\n"));
+		Check(DensityMatches(large, false), "плотность на поле 64x64");
+	}
+
+	void TestTournament()
+	{
+		const StrategyRegistry& registry = StrategyRegistry::Instance();
+		RepeatingTargeting repeating;
+		AIPlayer cheater("A", FleetConfig(), registry.GetPlacement("random"), repeating, 1);
+		AIPlayer honest("B", FleetConfig(), registry.GetPlacement("random"), registry.GetTargeting("density"), 2);
+
+		bool rejected = false;
+		try
+		{
+			MatchEngine::Play(cheater, honest);
+		}
+		catch (const std::logic_error&)
+		{
+			rejected = true;
+		}
+		Check(rejected, "повторный выстрел прерывает партию");
+
+		// Ошибка в потоке турнира доходит до вызывающего, а не завершает программу
+		rejected = false;
+		try
+		{
+			Tournament::Run({ &registry.GetPlacement("random"), &repeating }, Tournament::MakeContestant("density"),
+				100, FleetConfig(), 2);
+		}
+		catch (const std::logic_error&)
+		{
+			rejected = true;
+		}
+		Check(rejected, "турнир передаёт ошибку партии");
+
+		// Итог не зависит от числа потоков
+		const Tournament::Contestant first = Tournament::MakeContestant("density");
+		const Tournament::Contestant second = Tournament::MakeContestant("parity");
+		Tournament::Report parallel = Tournament::Run(first, second, 500, FleetConfig(), 2, 42);
+		Tournament::Report single = Tournament::Run(first, second, 500, FleetConfig(), 1, 42);
+		Check(single.firstWins == parallel.firstWins && single.secondWins == parallel.secondWins, "один поток даёт тот же итог");
+	}
+
+	void TestTargetCells()
+	{
+		FleetConfig fleet;
+		GameBoard board(10);
+		board.PlaceShip(Ship(3, { 0, 0 }, true));
+		board.PlaceShip(Ship(2, { 5, 5 }, false));
+		BoardView view(fleet);
+		for (BoardView::MoveType move : { BoardView::MoveType{ 0, 0 }, BoardView::MoveType{ 0, 1 }, BoardView::MoveType{ 5, 5 } })
+		{
+			view.Update(board.ReceiveShot(move), move);
+		}
+
+		// Линия продолжается вдоль себя, одиночное попадание другого корабля - во все стороны
+		BitBoard cells = ParityTargeting::GetTargetCells(view);
+		Check(cells.Count() == 5 && cells.Test(0, 2) && cells.Test(4, 5) && cells.Test(6, 5) && cells.Test(5, 4) && cells.Test(5, 6),
+			"направления добивания по группам попаданий");
+	}
+
+	void TestFleetConfig()
+	{
+		Check(LoadFleet("board;12\nship;2;#./##\nship;3;##\n").GetBoardSize() == 12, "загрузка флота");
+
+		const char* invalid[] = {
+			"board;65\nship;1;#\n",						// поле больше BitBoard::MAX_SIZE
+			"board;3\nship;1;#####\n",					// корабль длиннее поля
+			"board;3\nship;1;###/#../#..\nship;2;#\n",	// по площади помещается, без касаний - нет
+			"board;10\nship;0;#\n",
+			"board;10\nflag;1\n"
+		};
+		for (const char* text : invalid)
+		{
+			bool rejected = false;
+			try
+			{
+				LoadFleet(text);
+			}
+			catch (const std::invalid_argument&)
+			{
+				rejected = true;
+			}
+			Check(rejected, std::string("флот отвергается: ") + text);
+		}
+	}
+
+	void TestRecords()
+	{
+		const std::string path = "BattleshipTests.records";
+		const Tournament::Contestant first = Tournament::MakeContestant("density");
+		const Tournament::Contestant second = Tournament::MakeContestant("parity");
+
+		Tournament::Report report;
+		{
+			GameRecordWriter writer(path);
+			report = Tournament::Run(first, second, 500, FleetConfig(), 2, 42, &writer);
+			Check(writer.Close() && writer.GetRecordCount() == 500, "все записи отданы на диск");
+		}
+
+		// Каждая партия воспроизводится, и итоги совпадают с отчётом турнира
+		GameRecordReader reader(path);
+		GameRecord record;
+		long long games = 0;
+		long long firstWins = 0;
+		bool replayed = true;
+		while (reader.Next(record))
+		{
+			games++;
+			firstWins += record.winner >= 0 && record.names[record.winner] == first.GetName() ? 1 : 0;
+			try
+			{
+				GameReplay replay(record);
+				replay.SeekTo(replay.GetTurnCount());
+				replayed = replayed && (record.winner < 0 || replay.GetBoard(1 - record.winner).IsAllShipsSunk());
+			}
+			catch (const std::exception&)
+			{
+				replayed = false;
+			}
+		}
+		Check(games == 500 && firstWins == report.firstWins, "записи совпадают с отчётом турнира");
+		Check(replayed, "все партии воспроизводятся до того же итога");
+
+		// Пакет, переживший писателя, не роняет программу, а Close сообщает о потере
+		GameRecordWriter writer(path);
+		{
+			GameRecordWriter::Batch batch(writer);
+			batch.Add(record);
+			Check(writer.Close(), "пустой файл записан");
+		}
+		Check(!writer.Close(), "потерянные записи приводят к ошибке Close");
+		std::remove(path.c_str());
+	}
+
+	void Run(const char* name, void (*test)())
+	{
+		int before = failures;
+		auto start = std::chrono::steady_clock::now();
+		test();
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::cout << (failures == before ? "[ ok ] " : "[FAIL] ") << name << " (" << static_cast<long long>(milliseconds) << " мс)" << std::endl;
+	}
+}
+
+int main()
+{
+	// Устанавливаем локаль для поддержки русского языка
+	setlocale(LC_ALL, "Russian");
+
+	Run("поле и выстрелы", TestBoard);
+	Run("генератор флота", TestFleetGenerator);
+	Run("плотность против перебора", TestDensity);
+	Run("турнир и проверка ходов", TestTournament);
+	Run("клетки добивания", TestTargetCells);
+	Run("конфигурация флота", TestFleetConfig);
+	Run("записи и воспроизведение", TestRecords);
+
+	std::cout << (failures == 0 ? "Все проверки прошли" : "Провалено проверок: " + std::to_string(failures)) << std::endl;
+	return failures;
+}
\ No newline at end of file
@@ -0,0 +1,243 @@
+﻿#include "Benchmark.hpp"
+#include "FleetGenerator.hpp"
+#include "DensityTargeting.hpp"
+#include "BoardView.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <set>
+#include <sstream>
+
+namespace Battleship {
+	namespace {
+		// Прежнее поле: выстрелы в std::set, поиск попадания перебором координат кораблей.
+		// Оставлено только для сравнения в замерах
+		class SetBoard
+		{
+		public:
+			SetBoard(const GameBoard::ShipsType& ships)
+				: m_ships(ships)
+			{
+			}
+
+			Ship::ShotResult ReceiveShot(std::pair<int, int> coord)
+			{
+				if (m_shots.find(coord) != m_shots.end())
+				{
+					return Ship::ShotResult::eAlreadyShot;
+				}
+
+				m_shots.insert(coord);
+
+				for (auto& ship : m_ships)
+				{
+					if (ship.TakeHit(coord))
+					{
+						if (ship.IsSunk())
+						{
+							return Ship::ShotResult::eSunk;
+						}
+						return Ship::ShotResult::eHit;
+					}
+				}
+
+				m_misses.push_back(coord);
+				return Ship::ShotResult::eMiss;
+			}
+
+			bool IsAllShipsSunk() const
+			{
+				for (const auto& ship : m_ships)
+				{
+					if (!ship.IsSunk())
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+
+		private:
+			GameBoard::ShipsType m_ships;
+			std::set<std::pair<int, int>> m_shots;
+			std::vector<std::pair<int, int>> m_misses;
+		};
+
+		// Стреляет по каждому полю из копий, пока флот не потоплен; возвращает число выстрелов
+		template <typename Board>
+		long long FireAll(std::vector<Board>& boards, const std::vector<std::pair<int, int>>& order, double& milliseconds)
+		{
+			long long shots = 0;
+			auto start = std::chrono::steady_clock::now();
+			for (auto& board : boards)
+			{
+				for (const auto& coord : order)
+				{
+					board.ReceiveShot(coord);
+					shots++;
+					if (board.IsAllShipsSunk()) break;
+				}
+			}
+			auto finish = std::chrono::steady_clock::now();
+			milliseconds = std::chrono::duration<double, std::milli>(finish - start).count();
+			return shots;
+		}
+	}
+
+	FleetConfig Benchmark::MakeStandardFleet(int size)
+	{
+		return FleetConfig(size, FleetConfig().GetShipTypes());
+	}
+
+	void Benchmark::PlaceFleet(GameBoard& board, std::uint32_t seed)
+	{
+		FleetGenerator generator(MakeStandardFleet(board.GetSize()), seed);
+		generator.PlaceFleet(board);
+	}
+
+	Benchmark::Result Benchmark::MeasureFleetGeneration(const FleetConfig& fleet, int fleets, std::uint32_t seed)
+	{
+		FleetGenerator generator(fleet, seed);
+		const int size = fleet.GetBoardSize();
+
+		int generated = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < fleets; i++)
+		{
+			generated += generator.Generate() ? 1 : 0;
+		}
+		auto finish = std::chrono::steady_clock::now();
+
+		std::ostringstream name;
+		name << "FleetGenerator " << size << "x" << size;
+
+		Result result;
+		result.name = name.str();
+		result.unit = "fleets/sec";
+		result.operations = generated;
+		result.totalMilliseconds = std::chrono::duration<double, std::milli>(finish - start).count();
+		return result;
+	}
+
+	Benchmark::Result Benchmark::MeasureTargeting(const FleetConfig& fleet, int games, std::uint32_t seed)
+	{
+		FleetGenerator generator(fleet, seed);
+		const int size = fleet.GetBoardSize();
+
+		long long shots = 0;
+		double milliseconds = 0;
+		for (int game = 0; game < games; game++)
+		{
+			GameBoard board(size);
+			generator.PlaceFleet(board);
+
+			// В замер входит только выбор выстрела и обновление знаний о поле
+			DensityTargeting targeting;
+			BoardView view(fleet);
+			RandomEngine random(seed + game);
+			auto start = std::chrono::steady_clock::now();
+			while (!board.IsAllShipsSunk())
+			{
+				BoardView::MoveType move = targeting.SelectShot(view, random);
+				view.Update(board.ReceiveShot(move), move);
+				shots++;
+			}
+			auto finish = std::chrono::steady_clock::now();
+			milliseconds += std::chrono::duration<double, std::milli>(finish - start).count();
+		}
+
+		std::ostringstream name;
+		name << "DensityTargeting " << size << "x" << size;
+
+		Result result;
+		result.name = name.str();
+		result.unit = "shots/sec";
+		result.operations = shots;
+		result.totalMilliseconds = milliseconds;
+		return result;
+	}
+
+	std::vector<Benchmark::Result> Benchmark::MeasureShots(int boards, std::uint32_t seed)
+	{
+		GameBoard prototype(GameBoard::DEFAULT_BOARD_SIZE);
+		PlaceFleet(prototype, seed);
+
+		// Один и тот же порядок выстрелов для обеих реализаций
+		std::vector<std::pair<int, int>> order;
+		for (int i = 0; i < prototype.GetSize(); i++)
+		{
+			for (int j = 0; j < prototype.GetSize(); j++)
+			{
+				order.push_back({ i, j });
+			}
+		}
+		std::mt19937 gen(seed);
+		std::shuffle(order.begin(), order.end(), gen);
+
+		// Копии готовятся заранее, чтобы в замер не попадало копирование
+		std::vector<GameBoard> bitBoards(boards, prototype);
+		std::vector<SetBoard> setBoards(boards, SetBoard(prototype.GetShips()));
+
+		Result bitResult;
+		bitResult.name = "GameBoard (bitboard)";
+		bitResult.unit = "shots/sec";
+		bitResult.operations = FireAll(bitBoards, order, bitResult.totalMilliseconds);
+
+		Result setResult;
+		setResult.name = "Reference (std::set)";
+		setResult.unit = "shots/sec";
+		setResult.operations = FireAll(setBoards, order, setResult.totalMilliseconds);
+
+		return { bitResult, setResult };
+	}
+
+	std::vector<Benchmark::Result> Benchmark::RunShotBenchmark(std::ostream& out)
+	{
+		const int BOARDS = 10000;
+
+		std::vector<Result> results = MeasureShots(BOARDS);
+		PrintResults(results, out);
+		return results;
+	}
+
+	std::vector<Benchmark::Result> Benchmark::RunFleetBenchmark(std::ostream& out)
+	{
+		const int FLEETS = 1000000;
+
+		std::vector<Result> results;
+		for (int size : { GameBoard::DEFAULT_BOARD_SIZE, 30, BitBoard::MAX_SIZE })
+		{
+			results.push_back(MeasureFleetGeneration(MakeStandardFleet(size), FLEETS));
+		}
+
+		PrintResults(results, out);
+		return results;
+	}
+
+	std::vector<Benchmark::Result> Benchmark::RunTargetingBenchmark(std::ostream& out)
+	{
+		const int GAMES = 1000;
+
+		std::vector<Result> results;
+		for (int size : { GameBoard::DEFAULT_BOARD_SIZE, 30, BitBoard::MAX_SIZE })
+		{
+			results.push_back(MeasureTargeting(MakeStandardFleet(size), GAMES));
+		}
+
+		PrintResults(results, out);
+		return results;
+	}
+
+	void Benchmark::PrintResults(const std::vector<Result>& results, std::ostream& out)
+	{
+		out << "=== Battleship Benchmark ===\n";
+		for (const auto& result : results)
+		{
+			out << std::left << std::setw(24) << result.name
+				<< std::right << std::setw(14) << std::fixed << std::setprecision(0)
+				<< result.GetOperationsPerSecond() << " " << result.unit
+				<< " (" << result.operations << " in " << std::setprecision(1) << result.totalMilliseconds << " ms)\n";
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include "GameBoard.hpp"
+#include "FleetConfig.hpp"
+
+namespace Battleship {
+	// Замеры производительности игрового поля "Морского боя" (без интерфейса)
+	class Benchmark
+	{
+	public:
+		// Результат одного замера
+		struct Result
+		{
+			std::string name;
+			std::string unit;
+			long long operations;
+			double totalMilliseconds;
+
+			double GetOperationsPerSecond() const
+			{
+				return totalMilliseconds > 0 ? operations * 1000.0 / totalMilliseconds : 0.0;
+			}
+		};
+
+	public:
+		// публичные методы
+
+		// Стандартный флот на поле size x size
+		static FleetConfig MakeStandardFleet(int size);
+
+		// Расставляет стандартный флот на поле
+		static void PlaceFleet(GameBoard& board, std::uint32_t seed);
+
+		// Замеряет генерацию fleets расстановок флота
+		static Result MeasureFleetGeneration(const FleetConfig& fleet, int fleets, std::uint32_t seed = 42);
+
+		// Обстреливает boards копий поля в случайном порядке до потопления флота:
+		// GameBoard против прежней реализации на std::set
+		static std::vector<Result> MeasureShots(int boards, std::uint32_t seed = 42);
+
+		// Замеряет выбор выстрела по плотности: games партий до потопления флота
+		static Result MeasureTargeting(const FleetConfig& fleet, int games, std::uint32_t seed = 42);
+
+		// Прогоняет замер выстрелов и печатает отчёт
+		static std::vector<Result> RunShotBenchmark(std::ostream& out = std::cout);
+
+		// Прогоняет генерацию флота на полях 10x10, 30x30 и 64x64 и печатает отчёт
+		static std::vector<Result> RunFleetBenchmark(std::ostream& out = std::cout);
+
+		// Прогоняет выбор выстрела по плотности на полях 10x10, 30x30 и 64x64 и печатает отчёт
+		static std::vector<Result> RunTargetingBenchmark(std::ostream& out = std::cout);
+
+		// Печатает результаты в виде таблицы
+		static void PrintResults(const std::vector<Result>& results, std::ostream& out);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <bit>
+
+namespace Battleship {
+	// Битовая маска поля: одна строка поля - одно 64-битное слово, столбец - номер бита.
+	// Операции над масками проходят только по занятым строкам (m_size слов)
+	class BitBoard
+	{
+	public:
+		static const int MAX_SIZE = 64;
+
+		// публичные: переопределение типом
+		using RowType = std::uint64_t;
+		using RowsType = std::array<RowType, MAX_SIZE>;
+
+	public:
+		// конструкторы и деконструктор
+		BitBoard(int size = 0)
+			: m_size(size)
+			, m_rows{}
+		{
+			if (size < 0 || size > MAX_SIZE)
+			{
+				throw std::out_of_range("Board size must be in range 0..64");
+			}
+		}
+		~BitBoard() = default;
+
+		// публичные методы
+		bool Test(int row, int col) const { return (m_rows[row] >> col) & 1; }
+		void Set(int row, int col) { m_rows[row] |= RowType(1) << col; }
+		void Reset(int row, int col) { m_rows[row] &= ~(RowType(1) << col); }
+
+		void Clear()
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				m_rows[i] = 0;
+			}
+		}
+
+		// Есть ли хотя бы одна общая клетка
+		bool Intersects(const BitBoard& other) const
+		{
+			RowType common = 0;
+			for (int i = 0; i < m_size; i++)
+			{
+				common |= m_rows[i] & other.m_rows[i];
+			}
+			return common != 0;
+		}
+
+		// Все ли клетки этой маски есть в other
+		bool IsSubsetOf(const BitBoard& other) const
+		{
+			RowType rest = 0;
+			for (int i = 0; i < m_size; i++)
+			{
+				rest |= m_rows[i] & ~other.m_rows[i];
+			}
+			return rest == 0;
+		}
+
+		bool IsEmpty() const
+		{
+			RowType any = 0;
+			for (int i = 0; i < m_size; i++)
+			{
+				any |= m_rows[i];
+			}
+			return any == 0;
+		}
+
+		int Count() const
+		{
+			int count = 0;
+			for (int i = 0; i < m_size; i++)
+			{
+				count += std::popcount(m_rows[i]);
+			}
+			return count;
+		}
+
+		BitBoard& operator|=(const BitBoard& other)
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				m_rows[i] |= other.m_rows[i];
+			}
+			return *this;
+		}
+
+		BitBoard& operator&=(const BitBoard& other)
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				m_rows[i] &= other.m_rows[i];
+			}
+			return *this;
+		}
+
+		// Убирает клетки other из маски
+		BitBoard& Subtract(const BitBoard& other)
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				m_rows[i] &= ~other.m_rows[i];
+			}
+			return *this;
+		}
+
+		// Клетка с номером rank (с нуля) среди установленных, по строкам; false, если столько нет
+		bool Select(int rank, int& row, int& col) const
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				int count = std::popcount(m_rows[i]);
+				if (rank < count)
+				{
+					RowType bits = m_rows[i];
+					for (int k = 0; k < rank; k++)
+					{
+						bits &= bits - 1;
+					}
+					row = i;
+					col = std::countr_zero(bits);
+					return true;
+				}
+				rank -= count;
+			}
+			return false;
+		}
+
+		// Маска, расширенная на одну клетку во все 8 сторон (в пределах поля)
+		BitBoard Dilate() const
+		{
+			BitBoard result(m_size);
+			RowType previous = 0;
+			RowType current = m_size > 0 ? Spread(m_rows[0]) : 0;
+			for (int i = 0; i < m_size; i++)
+			{
+				RowType next = i + 1 < m_size ? Spread(m_rows[i + 1]) : 0;
+				result.m_rows[i] = previous | current | next;
+				previous = current;
+				current = next;
+			}
+			return result;
+		}
+
+		// геттеры
+		int GetSize() const { return m_size; }
+		RowType GetRowMask() const { return MakeRowMask(m_size); }
+
+		// Биты столбцов 0..size-1
+		static RowType MakeRowMask(int size) { return size == MAX_SIZE ? ~RowType(0) : (RowType(1) << size) - 1; }
+		RowType GetRow(int row) const { return m_rows[row]; }
+		void SetRow(int row, RowType bits) { m_rows[row] = bits; }
+
+	private:
+		// приватные методы
+		RowType Spread(RowType row) const { return (row | (row << 1) | (row >> 1)) & GetRowMask(); }
+
+		// приватные переменные
+		int m_size;
+		RowsType m_rows;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+﻿#include "BoardView.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Battleship {
+	BoardView::BoardView(const FleetConfig& fleet)
+		: m_fleet(fleet)
+		, m_size(fleet.GetBoardSize())
+		, m_shots(fleet.GetBoardSize())
+		, m_hits(fleet.GetBoardSize())
+		, m_blocked(fleet.GetBoardSize())
+	{
+		for (const auto& type : fleet.GetShipTypes())
+		{
+			m_remaining.push_back(type.count);
+		}
+	}
+
+	void BoardView::Update(Ship::ShotResult result, MoveType move)
+	{
+		if (result == Ship::ShotResult::eAlreadyShot)
+		{
+			return;
+		}
+
+		m_shots.Set(move.first, move.second);
+		if (result == Ship::ShotResult::eMiss)
+		{
+			m_blocked.Set(move.first, move.second);
+			return;
+		}
+
+		m_hits.Set(move.first, move.second);
+		if (result == Ship::ShotResult::eSunk)
+		{
+			MarkSunk(move);
+		}
+	}
+
+	BitBoard BoardView::GetOpenCells() const
+	{
+		BitBoard open(m_size);
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(m_size);
+		for (int i = 0; i < m_size; i++)
+		{
+			open.SetRow(i, ~(m_shots.GetRow(i) | m_blocked.GetRow(i)) & rowMask);
+		}
+		return open;
+	}
+
+	int BoardView::GetParityStep() const
+	{
+		int step = 0;
+		for (size_t i = 0; i < m_remaining.size(); i++)
+		{
+			if (m_remaining[i] > 0)
+			{
+				int span = m_fleet.GetShipType(static_cast<int>(i)).shape.GetDiagonalSpan();
+				step = step == 0 ? span : std::min(step, span);
+			}
+		}
+		return step;
+	}
+
+	void BoardView::MarkSunk(MoveType move)
+	{
+		// Корабли не касаются даже углами, поэтому потопленный корабль - все попадания,
+		// связные с клеткой выстрела через соседние клетки
+		BitBoard ship(m_size);
+		ship.Set(move.first, move.second);
+		int size = 1;
+		for (;;)
+		{
+			BitBoard grown = ship.Dilate();
+			grown &= m_hits;
+			int grownSize = grown.Count();
+			if (grownSize == size)
+			{
+				break;
+			}
+			ship = grown;
+			size = grownSize;
+		}
+
+		// Тип корабля - первый тип на плаву с такой формой; у флота из прямых кораблей форму задаёт размер
+		ShipShape::CellsType cells;
+		if (!m_fleet.IsLinear())
+		{
+			for (int i = 0; i < m_size; i++)
+			{
+				for (BitBoard::RowType bits = ship.GetRow(i); bits != 0; bits &= bits - 1)
+				{
+					cells.push_back({ i, std::countr_zero(bits) });
+				}
+			}
+		}
+		for (size_t i = 0; i < m_remaining.size(); i++)
+		{
+			const ShipShape& shape = m_fleet.GetShipType(static_cast<int>(i)).shape;
+			if (m_remaining[i] > 0 && shape.GetSize() == size && (m_fleet.IsLinear() || shape.Matches(cells)))
+			{
+				m_remaining[i]--;
+				break;
+			}
+		}
+
+		// Клетки корабля и вокруг него больше не могут содержать кораблей
+		m_hits.Subtract(ship);
+		m_blocked |= ship.Dilate();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+﻿#pragma once
+
+#include <vector>
+#include <utility>
+#include "GameBoard.hpp"
+#include "FleetConfig.hpp"
+#include "BitBoard.hpp"
+
+namespace Battleship {
+	// Что стреляющий знает о поле противника: куда стрелял, какие попадания ещё
+	// не стали потопленными кораблями, где кораблей точно нет и какие корабли на плаву.
+	// Всё состояние партии для стратегий выбора выстрела хранится здесь,
+	// поэтому сами стратегии не имеют состояния и общие для всех потоков
+	class BoardView
+	{
+	public:
+		// публичные: переопределение типом
+		using MoveType = std::pair<int, int>;
+		using RemainingType = std::vector<int>;
+
+	public:
+		// конструкторы и деконструктор
+		BoardView(const FleetConfig& fleet);
+		~BoardView() = default;
+
+		// публичные методы
+		void Update(Ship::ShotResult result, MoveType move);
+
+		// Клетки, куда ещё можно стрелять с пользой: не стреляли и корабль там возможен
+		BitBoard GetOpenCells() const;
+
+		// Шаг шахматного поиска: наименьшее число диагоналей, которое накрывает корабль на плаву;
+		// 0, если все потоплены
+		int GetParityStep() const;
+
+		// геттеры
+		int GetSize() const { return m_size; }
+		const FleetConfig& GetFleet() const { return m_fleet; }
+		bool HasTargets() const { return !m_hits.IsEmpty(); }
+		const BitBoard& GetShots() const { return m_shots; }
+		const BitBoard& GetHits() const { return m_hits; }
+		const BitBoard& GetBlocked() const { return m_blocked; }
+		const RemainingType& GetRemaining() const { return m_remaining; }
+
+	private:
+		// приватные методы
+		void MarkSunk(MoveType move);
+
+		// приватные переменные
+		FleetConfig m_fleet;
+		int m_size;
+		BitBoard m_shots;				// все выстрелы
+		BitBoard m_hits;				// попадания в ещё не потопленные корабли
+		BitBoard m_blocked;				// промахи и потопленные корабли с соседними клетками: кораблей там нет
+		RemainingType m_remaining;		// сколько кораблей каждого типа FleetConfig ещё на плаву
+	};
+}
\ No newline at end of file
@@ -0,0 +1,436 @@
+﻿#include "ConsoleRenderer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else
+#include <unistd.h>
+#endif
+
+namespace Battleship {
+	namespace {
+		// Цвет клетки по её символу
+		const char* GetColor(char symbol)
+		{
+			switch (symbol)
+			{
+			case 'S': return "\x1b[36m";
+			case 'X': return "\x1b[91m";
+			case 'O': return "\x1b[94m";
+			default: return "\x1b[90m";
+			}
+		}
+
+		// Ширина текста в символах, в той кодировке, в которой он выводится:
+		// на Windows строки в ANSI (CP1251) - байт на символ, иначе UTF-8,
+		// где продолжающие байты места не занимают
+		int GetVisibleLength(const std::string& text)
+		{
+#ifdef _WIN32
+			return static_cast<int>(text.size());
+#else
+			int length = 0;
+			for (unsigned char c : text)
+			{
+				length += (c & 0xC0) != 0x80;
+			}
+			return length;
+#endif
+		}
+	}
+
+	ConsoleRenderer::ConsoleRenderer()
+		: m_ansi(EnableAnsi())
+		, m_onScreen(false)
+		, m_lineCount(0)
+		, m_previousCount(0)
+	{
+		// Кадра стандартного поля хватает без перевыделений
+		m_output.reserve(1 << 14);
+	}
+
+	void ConsoleRenderer::BeginFrame()
+	{
+		m_lineCount = 0;
+	}
+
+	void ConsoleRenderer::AddText(const std::string& text)
+	{
+		NextLine() += text;
+	}
+
+	void ConsoleRenderer::AddBoards(const std::string& leftTitle, const GameBoard& left, bool leftForOwner,
+		const std::string& rightTitle, const GameBoard& right, bool rightForOwner)
+	{
+		int leftWidth = GetSegmentWidth(left);
+
+		std::string& titles = NextLine();
+		titles += leftTitle;
+		Pad(titles, leftWidth + BOARDS_GAP);
+		titles += rightTitle;
+
+		// Номера столбцов по разрядам, старший сверху; у полей разной ширины выравниваются по нижней строке
+		int leftDigits = GetLabelWidth(left.GetSize());
+		int rightDigits = GetLabelWidth(right.GetSize());
+		int headerRows = std::max(leftDigits, rightDigits);
+		for (int digit = headerRows - 1; digit >= 0; digit--)
+		{
+			std::string& line = NextLine();
+			if (digit < leftDigits)
+			{
+				AppendHeaderRow(line, left.GetSize(), digit);
+			}
+			else
+			{
+				line.append(leftWidth, ' ');
+			}
+			line.append(BOARDS_GAP, ' ');
+			if (digit < rightDigits)
+			{
+				AppendHeaderRow(line, right.GetSize(), digit);
+			}
+		}
+
+		int rows = std::max(left.GetSize(), right.GetSize());
+		for (int row = 0; row < rows; row++)
+		{
+			std::string& line = NextLine();
+			if (row < left.GetSize())
+			{
+				AppendBoardRow(line, left, leftForOwner, row);
+			}
+			else
+			{
+				line.append(leftWidth, ' ');
+			}
+			line.append(BOARDS_GAP, ' ');
+			if (row < right.GetSize())
+			{
+				AppendBoardRow(line, right, rightForOwner, row);
+			}
+		}
+	}
+
+	void ConsoleRenderer::Present()
+	{
+		m_output.clear();
+
+		if (!m_ansi)
+		{
+			// Без ANSI кадр просто дописывается целиком
+			for (int i = 0; i < m_lineCount; i++)
+			{
+				m_output += m_lines[i];
+				m_output += '\n';
+			}
+			Write(m_output);
+			return;
+		}
+
+		AppendEvents();
+		int count = m_lineCount + EVENT_LINES;
+
+		if (!m_onScreen)
+		{
+			m_output += "\x1b[H\x1b[2J";
+		}
+
+		// Каждая изменившаяся строка: курсор в её начало, текст, очистка хвоста прежней строки
+		for (int i = 0; i < count; i++)
+		{
+			if (m_onScreen && i < m_previousCount && m_lines[i] == m_previous[i])
+			{
+				continue;
+			}
+
+			m_output += "\x1b[";
+			m_output += std::to_string(i + 1);
+			m_output += ";1H";
+			m_output += m_lines[i];
+			m_output += "\x1b[K";
+
+			if (i < static_cast<int>(m_previous.size()))
+			{
+				m_previous[i] = m_lines[i];
+			}
+			else
+			{
+				m_previous.push_back(m_lines[i]);
+			}
+		}
+
+		// Курсор под кадр; ниже стирается вывод, оставшийся от прошлого хода
+		m_output += "\x1b[";
+		m_output += std::to_string(count + 1);
+		m_output += ";1H\x1b[J";
+
+		m_previousCount = count;
+		m_onScreen = true;
+		Write(m_output);
+	}
+
+	void ConsoleRenderer::AddEvent(const std::string& text)
+	{
+		if (m_ansi)
+		{
+			if (static_cast<int>(m_events.size()) == EVENT_LINES)
+			{
+				m_events.erase(m_events.begin());
+			}
+			m_events.push_back(text);
+
+			// Кадр на экране: перерисуются только строки журнала
+			if (m_onScreen)
+			{
+				Present();
+				return;
+			}
+		}
+
+		m_output.clear();
+		m_output += text;
+		m_output += '\n';
+		Write(m_output);
+	}
+
+	void ConsoleRenderer::PrintBoard(const GameBoard& board, bool forOwner)
+	{
+		m_output.clear();
+		for (int digit = GetLabelWidth(board.GetSize()) - 1; digit >= 0; digit--)
+		{
+			AppendHeaderRow(m_output, board.GetSize(), digit);
+			m_output += '\n';
+		}
+		for (int row = 0; row < board.GetSize(); row++)
+		{
+			AppendBoardRow(m_output, board, forOwner, row);
+			m_output += '\n';
+		}
+		Write(m_output);
+
+		// Вывод сдвинул экран
+		Invalidate();
+	}
+
+	std::string ConsoleRenderer::FormatCell(char symbol) const
+	{
+		std::string cell;
+		char current = 0;
+		AppendCell(cell, symbol, current);
+		if (m_ansi)
+		{
+			cell += "\x1b[0m";
+		}
+		return cell;
+	}
+
+	std::string& ConsoleRenderer::NextLine()
+	{
+		if (m_lineCount == static_cast<int>(m_lines.size()))
+		{
+			m_lines.emplace_back();
+		}
+		std::string& line = m_lines[m_lineCount++];
+		line.clear();
+		return line;
+	}
+
+	void ConsoleRenderer::AppendCell(std::string& line, char symbol, char& current) const
+	{
+		// Цвет переключается только на границе клеток разного вида
+		if (m_ansi && symbol != current)
+		{
+			line += GetColor(symbol);
+			current = symbol;
+		}
+		line += symbol;
+	}
+
+	void ConsoleRenderer::AppendBoardRow(std::string& line, const GameBoard& board, bool forOwner, int row) const
+	{
+		AppendLabel(line, row, GetLabelWidth(board.GetSize()));
+		line += ' ';
+
+		// Состояние строки берётся из масок поля: попадания владелец видит по кораблям, противник - по hits
+		BitBoard::RowType shots = board.GetShots().GetRow(row);
+		BitBoard::RowType ships = forOwner ? board.GetOccupied().GetRow(row) : board.GetHits().GetRow(row);
+
+		char current = 0;
+		for (int col = 0; col < board.GetSize(); col++)
+		{
+			BitBoard::RowType bit = BitBoard::RowType(1) << col;
+			char symbol = '.';
+			if (shots & bit)
+			{
+				symbol = (ships & bit) ? 'X' : 'O';
+			}
+			else if (forOwner && (ships & bit))
+			{
+				symbol = 'S';
+			}
+			AppendCell(line, symbol, current);
+			line += ' ';
+		}
+
+		if (m_ansi && current != 0)
+		{
+			line += "\x1b[0m";
+		}
+	}
+
+	void ConsoleRenderer::AppendEvents()
+	{
+		size_t count = static_cast<size_t>(m_lineCount) + EVENT_LINES;
+		if (m_lines.size() < count)
+		{
+			m_lines.resize(count);
+		}
+		for (int i = 0; i < EVENT_LINES; i++)
+		{
+			std::string& line = m_lines[m_lineCount + i];
+			line.clear();
+			if (i < static_cast<int>(m_events.size()))
+			{
+				line += m_events[i];
+			}
+		}
+	}
+
+	void ConsoleRenderer::Write(const std::string& data)
+	{
+		// Всё, что уже накоплено в потоках, должно оказаться на экране раньше кадра
+		std::cout.flush();
+		std::fflush(stdout);
+
+#ifdef _WIN32
+		// Строки в ANSI (CP1251), а консоль работает в OEM (866): байты как есть исказят кириллицу.
+		// В консоль кадр уходит в UTF-16 одной записью, в файл или канал - без перекодировки
+		HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+		DWORD mode = 0;
+		if (GetConsoleMode(output, &mode))
+		{
+			if (data.empty())
+			{
+				return;
+			}
+			int length = MultiByteToWideChar(CP_ACP, 0, data.data(), static_cast<int>(data.size()), nullptr, 0);
+			m_wide.resize(length);
+			MultiByteToWideChar(CP_ACP, 0, data.data(), static_cast<int>(data.size()), &m_wide[0], length);
+
+			const wchar_t* wideBegin = m_wide.data();
+			DWORD wideLeft = static_cast<DWORD>(length);
+			while (wideLeft > 0)
+			{
+				DWORD written = 0;
+				if (!WriteConsoleW(output, wideBegin, wideLeft, &written, nullptr) || written == 0)
+				{
+					break;
+				}
+				wideBegin += written;
+				wideLeft -= written;
+			}
+			return;
+		}
+#endif
+
+		const char* begin = data.data();
+		size_t left = data.size();
+		while (left > 0)
+		{
+#ifdef _WIN32
+			DWORD written = 0;
+			if (!WriteFile(output, begin, static_cast<DWORD>(left), &written, nullptr) ||
+				written == 0)
+			{
+				break;
+			}
+#else
+			ssize_t written = ::write(STDOUT_FILENO, begin, left);
+			if (written <= 0)
+			{
+				break;
+			}
+#endif
+			begin += written;
+			left -= static_cast<size_t>(written);
+		}
+	}
+
+	int ConsoleRenderer::GetLabelWidth(int size)
+	{
+		int width = 1;
+		for (int value = size - 1; value >= 10; value /= 10)
+		{
+			width++;
+		}
+		return width;
+	}
+
+	int ConsoleRenderer::GetSegmentWidth(const GameBoard& board)
+	{
+		return GetLabelWidth(board.GetSize()) + 1 + 2 * board.GetSize();
+	}
+
+	void ConsoleRenderer::AppendHeaderRow(std::string& line, int size, int digit)
+	{
+		int power = 1;
+		for (int i = 0; i < digit; i++)
+		{
+			power *= 10;
+		}
+
+		// Незначащие нули не выводятся: у столбцов 0..9 старшие разряды пустые
+		line.append(GetLabelWidth(size) + 1, ' ');
+		for (int col = 0; col < size; col++)
+		{
+			line += (digit == 0 || col >= power) ? static_cast<char>('0' + col / power % 10) : ' ';
+			line += ' ';
+		}
+	}
+
+	void ConsoleRenderer::AppendLabel(std::string& line, int value, int width)
+	{
+		std::string digits = std::to_string(value);
+		if (static_cast<int>(digits.size()) < width)
+		{
+			line.append(width - digits.size(), ' ');
+		}
+		line += digits;
+	}
+
+	void ConsoleRenderer::Pad(std::string& line, int width)
+	{
+		int length = GetVisibleLength(line);
+		if (length < width)
+		{
+			line.append(width - length, ' ');
+		}
+	}
+
+	bool ConsoleRenderer::EnableAnsi()
+	{
+#ifdef _WIN32
+		HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+		DWORD mode = 0;
+		if (output == INVALID_HANDLE_VALUE || !GetConsoleMode(output, &mode))
+		{
+			// Вывод перенаправлен в файл или канал
+			return false;
+		}
+		return (mode & ENABLE_VIRTUAL_TERMINAL_PROCESSING) != 0 ||
+			SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING) != 0;
+#else
+		const char* term = std::getenv("TERM");
+		return isatty(STDOUT_FILENO) && term != nullptr && std::string(term) != "dumb";
+#endif
+	}
+}
\ No newline at end of file
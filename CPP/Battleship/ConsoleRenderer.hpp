@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include "GameBoard.hpp"
+
+namespace Battleship {
+	// Консольный вывод кадрами: строки кадра собираются в переиспользуемые буферы
+	// и выводятся одной записью. Если консоль понимает ANSI, кадр занимает верх окна,
+	// клетки раскрашиваются, а на следующих кадрах перерисовываются только изменившиеся строки
+	class ConsoleRenderer
+	{
+	public:
+		// Строк журнала событий под кадром (только с ANSI; без него события печатаются сразу)
+		static const int EVENT_LINES = 5;
+
+		// Промежуток между полями, выведенными рядом
+		static const int BOARDS_GAP = 4;
+
+		// публичные: переопределение типом
+		using LinesType = std::vector<std::string>;
+
+	public:
+		// конструкторы и деконструктор
+		ConsoleRenderer();
+		~ConsoleRenderer() = default;
+
+		// публичные методы
+
+		// Начинает новый кадр
+		void BeginFrame();
+
+		// Строка текста
+		void AddText(const std::string& text);
+
+		// Два поля рядом с заголовками; forOwner - показывать ли неподбитые корабли
+		void AddBoards(const std::string& leftTitle, const GameBoard& left, bool leftForOwner,
+			const std::string& rightTitle, const GameBoard& right, bool rightForOwner);
+
+		// Выводит кадр вместе с журналом событий
+		void Present();
+
+		// Событие в журнал; кадр на экране обновляется сразу
+		void AddEvent(const std::string& text);
+
+		// Поле целиком, одной записью ниже текущего текста (без места в кадре)
+		void PrintBoard(const GameBoard& board, bool forOwner);
+
+		// Клетка с цветом, как она выглядит на поле
+		std::string FormatCell(char symbol) const;
+
+		// Следующий кадр перерисовать целиком: экран был изменён помимо кадра
+		void Invalidate() { m_onScreen = false; }
+
+		// геттеры
+		bool IsAnsiEnabled() const { return m_ansi; }
+
+	private:
+		// приватные методы
+		std::string& NextLine();
+		void AppendCell(std::string& line, char symbol, char& current) const;
+		void AppendBoardRow(std::string& line, const GameBoard& board, bool forOwner, int row) const;
+		void AppendEvents();
+		void Write(const std::string& data);
+
+		static int GetLabelWidth(int size);
+		static int GetSegmentWidth(const GameBoard& board);
+		static void AppendHeaderRow(std::string& line, int size, int digit);
+		static void AppendLabel(std::string& line, int value, int width);
+		static void Pad(std::string& line, int width);
+		static bool EnableAnsi();
+
+	private:
+		// приватные переменные
+		bool m_ansi;				// консоль понимает ANSI-последовательности
+		bool m_onScreen;			// m_previous совпадает с экраном
+		LinesType m_lines;			// строки собираемого кадра; буферы переиспользуются между кадрами
+		int m_lineCount;			// строк в кадре, без журнала
+		LinesType m_previous;		// выведенный кадр, с журналом
+		int m_previousCount;
+		LinesType m_events;			// журнал событий, последние EVENT_LINES
+		std::string m_output;		// всё, что уходит в консоль за одну запись
+		std::wstring m_wide;		// m_output в UTF-16 для консоли Windows
+	};
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+﻿#include "DensityTargeting.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Battleship {
+	DensityTargeting::MoveType DensityTargeting::SelectShot(const BoardView& view, RandomEngine& random) const
+	{
+		// Счётчики на стеке: объект стратегии общий для всех потоков
+		DensityType density;
+		MoveType move;
+
+		// Добивание; если ни одно место не накрывает попадания, возвращаемся к поиску
+		if (view.HasTargets())
+		{
+			ComputeDensity(view, true, density);
+			if (PickMaximum(view, density, random, move))
+			{
+				return move;
+			}
+		}
+
+		ComputeDensity(view, false, density);
+		if (PickMaximum(view, density, random, move))
+		{
+			return move;
+		}
+
+		// Запасной вариант: первая клетка, куда ещё не стреляли
+		for (int i = 0; i < view.GetSize(); i++)
+		{
+			BitBoard::RowType open = ~view.GetShots().GetRow(i) & BitBoard::MakeRowMask(view.GetSize());
+			if (open != 0)
+			{
+				return { i, std::countr_zero(open) };
+			}
+		}
+		return { 0, 0 };
+	}
+
+	void DensityTargeting::ComputeDensity(const BoardView& view, bool targeting, DensityType& density)
+	{
+		for (int i = 0; i < view.GetSize(); i++)
+		{
+			density[i].fill(0);
+		}
+
+		const BoardView::RemainingType& remaining = view.GetRemaining();
+		for (size_t i = 0; i < remaining.size(); i++)
+		{
+			if (remaining[i] == 0)
+			{
+				continue;
+			}
+			for (const auto& orientation : view.GetFleet().GetShipType(static_cast<int>(i)).shape.GetOrientations())
+			{
+				AddPlacements(view, orientation, remaining[i], targeting, density);
+			}
+		}
+	}
+
+	int DensityTargeting::GetDensity(const DensityType& density, int row, int col)
+	{
+		int value = 0;
+		for (int bit = 0; bit < COUNTER_BITS; bit++)
+		{
+			value |= static_cast<int>((density[row][bit] >> col) & 1) << bit;
+		}
+		return value;
+	}
+
+	void DensityTargeting::AddPlacements(const BoardView& view, const ShipShape::Orientation& orientation, int weight,
+		bool targeting, DensityType& density)
+	{
+		const int boardSize = view.GetSize();
+		const BitBoard& blocked = view.GetBlocked();
+		const BitBoard& knownHits = view.GetHits();
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(boardSize);
+		if (orientation.width > boardSize)
+		{
+			return;
+		}
+
+		// Без попаданий проверки накрытия и касания не нужны: так идёт почти весь поиск
+		const bool anyHits = view.HasTargets();
+
+		// Бит c в строке row - вариант формы с левым верхним углом рамки в (row, c)
+		for (int row = 0; row + orientation.height <= boardSize; row++)
+		{
+			// При добивании место должно накрывать попадание; это проверяется первым, так отсеивается почти всё
+			BitBoard::RowType starts = rowMask;
+			if (targeting)
+			{
+				BitBoard::RowType covers = 0;
+				for (const auto& cell : orientation.cells)
+				{
+					covers |= knownHits.GetRow(row + cell.first) >> cell.second;
+				}
+				starts &= covers;
+			}
+			for (const auto& cell : orientation.cells)
+			{
+				starts &= (~blocked.GetRow(row + cell.first) & rowMask) >> cell.second;
+			}
+			if (starts == 0)
+			{
+				continue;
+			}
+
+			// Чужое попадание рядом значит, что там другой корабль, а корабли не касаются
+			if (anyHits)
+			{
+				BitBoard::RowType touches = 0;
+				for (int i = -1; i <= orientation.height; i++)
+				{
+					int haloRow = row + i;
+					BitBoard::RowType hits = haloRow >= 0 && haloRow < boardSize ? knownHits.GetRow(haloRow) : 0;
+					if (hits == 0)
+					{
+						continue;
+					}
+					if (orientation.haloLeft[i + 1])
+					{
+						touches |= hits << 1;
+					}
+					for (BitBoard::RowType cells = orientation.haloRows[i + 1]; cells != 0; cells &= cells - 1)
+					{
+						touches |= hits >> std::countr_zero(cells);
+					}
+				}
+
+				starts &= ~touches;
+				if (starts == 0)
+				{
+					continue;
+				}
+			}
+
+			for (const auto& cell : orientation.cells)
+			{
+				AddToRow(density[row + cell.first], starts << cell.second, weight);
+			}
+		}
+	}
+
+	void DensityTargeting::AddToRow(CounterType& counter, BitBoard::RowType bits, int weight)
+	{
+		// Вес, не помещающийся в счётчик, сразу доводит клетки до максимума
+		if (weight > MAX_COUNTER)
+		{
+			Saturate(counter, bits);
+			return;
+		}
+
+		// Побитовое сложение: к каждому счётчику строки, где бит установлен, прибавляется weight -
+		// по единице в каждый двоичный разряд веса, а не weight раз по единице
+		for (int shift = 0; weight != 0; shift++, weight >>= 1)
+		{
+			if ((weight & 1) == 0)
+			{
+				continue;
+			}
+
+			BitBoard::RowType carry = bits;
+			for (int bit = shift; bit < COUNTER_BITS && carry != 0; bit++)
+			{
+				BitBoard::RowType next = counter[bit] & carry;
+				counter[bit] ^= carry;
+				carry = next;
+			}
+
+			// Перенос из старшего разряда - переполнение: счётчик не обнуляется, а остаётся на максимуме
+			if (carry != 0)
+			{
+				Saturate(counter, carry);
+			}
+		}
+	}
+
+	void DensityTargeting::Saturate(CounterType& counter, BitBoard::RowType bits)
+	{
+		for (int bit = 0; bit < COUNTER_BITS; bit++)
+		{
+			counter[bit] |= bits;
+		}
+	}
+
+	bool DensityTargeting::PickMaximum(const BoardView& view, const DensityType& density, RandomEngine& random, MoveType& move)
+	{
+		const int boardSize = view.GetSize();
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(boardSize);
+
+		// Кандидаты - клетки, куда ещё не стреляли, с ненулевой плотностью
+		std::array<BitBoard::RowType, BitBoard::MAX_SIZE> candidates;
+		BitBoard::RowType any = 0;
+		for (int i = 0; i < boardSize; i++)
+		{
+			BitBoard::RowType nonZero = 0;
+			for (int bit = 0; bit < COUNTER_BITS; bit++)
+			{
+				nonZero |= density[i][bit];
+			}
+			candidates[i] = nonZero & ~view.GetShots().GetRow(i) & rowMask;
+			any |= candidates[i];
+		}
+		if (any == 0)
+		{
+			return false;
+		}
+
+		// Максимум ищется со старшего бита: оставляем клетки, у которых бит установлен, если такие есть
+		for (int bit = COUNTER_BITS - 1; bit >= 0; bit--)
+		{
+			BitBoard::RowType present = 0;
+			for (int i = 0; i < boardSize; i++)
+			{
+				present |= candidates[i] & density[i][bit];
+			}
+			if (present == 0)
+			{
+				continue;
+			}
+			for (int i = 0; i < boardSize; i++)
+			{
+				candidates[i] &= density[i][bit];
+			}
+		}
+
+		// Среди равных - случайная клетка
+		int total = 0;
+		for (int i = 0; i < boardSize; i++)
+		{
+			total += std::popcount(candidates[i]);
+		}
+		int rank = static_cast<int>((static_cast<std::uint64_t>(random()) * total) >> 32);
+		for (int i = 0; i < boardSize; i++)
+		{
+			int count = std::popcount(candidates[i]);
+			if (rank < count)
+			{
+				BitBoard::RowType bits = candidates[i];
+				for (int k = 0; k < rank; k++)
+				{
+					bits &= bits - 1;
+				}
+				move = { i, std::countr_zero(bits) };
+				return true;
+			}
+			rank -= count;
+		}
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include <array>
+#include "Strategy.hpp"
+#include "BitBoard.hpp"
+
+namespace Battleship {
+	// Выбор выстрела по плотности вероятности. Для каждой клетки считается, сколько
+	// мест оставшихся кораблей (всех вариантов их форм) согласуются с известными
+	// промахами и попаданиями, и выбирается клетка с наибольшим числом. Пока есть
+	// неподбитые до конца попадания, учитываются только места, накрывающие попадание
+	// и не касающиеся других попаданий, поэтому добивание само идёт по уже найденной
+	// части корабля. Места перебираются масками по строкам, счётчики клеток хранятся побитово
+	class DensityTargeting : public TargetingStrategy
+	{
+	public:
+		// Клетку накрывают не больше MAX_ORIENTATIONS мест на каждую клетку флота, а флот
+		// не больше поля (это проверяет FleetConfig), так что счётчику хватает 16 бит.
+		// Если это когда-нибудь нарушится, счётчик остановится на MAX_COUNTER, а не обнулится
+		static const int COUNTER_BITS = 16;
+		static const int MAX_COUNTER = (1 << COUNTER_BITS) - 1;
+		static_assert(ShipShape::MAX_ORIENTATIONS * BitBoard::MAX_SIZE * BitBoard::MAX_SIZE <= MAX_COUNTER,
+			"COUNTER_BITS is too small for the largest board");
+
+		// публичные: переопределение типом
+		using CounterType = std::array<BitBoard::RowType, COUNTER_BITS>;
+		using DensityType = std::array<CounterType, BitBoard::MAX_SIZE>;	// счётчики клеток по битам, строка за строкой
+
+	public:
+		// публичные методы
+		std::string GetName() const override { return "density"; }
+		MoveType SelectShot(const BoardView& view, RandomEngine& random) const override;
+
+		// Плотность всех клеток; targeting - учитывать только места, накрывающие попадания
+		static void ComputeDensity(const BoardView& view, bool targeting, DensityType& density);
+		static int GetDensity(const DensityType& density, int row, int col);
+
+	private:
+		// приватные методы
+		static void AddPlacements(const BoardView& view, const ShipShape::Orientation& orientation, int weight, bool targeting,
+			DensityType& density);
+		static void AddToRow(CounterType& counter, BitBoard::RowType bits, int weight);
+		static void Saturate(CounterType& counter, BitBoard::RowType bits);
+		static bool PickMaximum(const BoardView& view, const DensityType& density, RandomEngine& random, MoveType& move);
+	};
+}
\ No newline at end of file
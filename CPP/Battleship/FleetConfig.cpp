@@ -0,0 +1,161 @@
+﻿#include "FleetConfig.hpp"
+#include "FleetGenerator.hpp"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace Battleship {
+	FleetConfig::FleetConfig()
+		: m_boardSize(GameBoard::DEFAULT_BOARD_SIZE)
+	{
+		// Стандартный флот разбирается один раз и общий для всех копий
+		static const std::shared_ptr<const Data> standard = MakeData(GameBoard::DEFAULT_BOARD_SIZE, {
+			{ ShipShape::MakeLine(4), 1 },
+			{ ShipShape::MakeLine(3), 2 },
+			{ ShipShape::MakeLine(2), 3 },
+			{ ShipShape::MakeLine(1), 4 }
+		});
+		m_data = standard;
+	}
+
+	FleetConfig::FleetConfig(int boardSize, const ShipTypesType& shipTypes)
+		: m_boardSize(boardSize)
+		, m_data(MakeData(boardSize, shipTypes))
+	{
+		CheckPlacement();
+	}
+
+	void FleetConfig::Load(std::istream& in)
+	{
+		int boardSize = GameBoard::DEFAULT_BOARD_SIZE;
+		ShipTypesType shipTypes;
+		std::string line;
+		int lineNumber = 0;
+
+		while (std::getline(in, line))
+		{
+			lineNumber++;
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.pop_back();
+			}
+			if (line.empty() || line[0] == '#')
+			{
+				continue;
+			}
+
+			std::istringstream fields(line);
+			std::string key, value, shape;
+			if (!std::getline(fields, key, ';') || !std::getline(fields, value, ';'))
+			{
+				throw std::invalid_argument("Malformed fleet config at line " + std::to_string(lineNumber));
+			}
+
+			try
+			{
+				if (key == "board" && !std::getline(fields, shape))
+				{
+					boardSize = std::stoi(value);
+				}
+				else if (key == "ship" && std::getline(fields, shape))
+				{
+					int count = std::stoi(value);
+					if (count <= 0)
+					{
+						throw std::invalid_argument("Ship count must be positive");
+					}
+					shipTypes.push_back({ ShipShape::Parse(shape), count });
+				}
+				else
+				{
+					throw std::invalid_argument("Unknown entry '" + key + "'");
+				}
+			}
+			catch (const std::exception& ex)
+			{
+				throw std::invalid_argument("Invalid fleet config at line " + std::to_string(lineNumber) + ": " + ex.what());
+			}
+		}
+
+		// Конфигурация меняется, только если весь файл корректен
+		*this = FleetConfig(boardSize, shipTypes);
+	}
+
+	bool FleetConfig::LoadFromFile(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file.is_open())
+		{
+			return false;
+		}
+		Load(file);
+		return true;
+	}
+
+	void FleetConfig::Print(std::ostream& out) const
+	{
+		out << "- Расставьте корабли на поле " << m_boardSize << "x" << m_boardSize << "\n";
+		out << "- Набор кораблей:\n";
+		for (const auto& type : m_data->shipTypes)
+		{
+			out << "  " << type.count << " x " << type.shape.GetSize() << " кл.";
+			if (!type.shape.IsLine())
+			{
+				out << " фигура " << type.shape.ToString();
+			}
+			out << "\n";
+		}
+	}
+
+	std::shared_ptr<const FleetConfig::Data> FleetConfig::MakeData(int boardSize, const ShipTypesType& shipTypes)
+	{
+		if (boardSize <= 0 || boardSize > BitBoard::MAX_SIZE)
+		{
+			throw std::invalid_argument("Board size must be between 1 and " + std::to_string(BitBoard::MAX_SIZE));
+		}
+		if (shipTypes.empty())
+		{
+			throw std::invalid_argument("Fleet has no ships");
+		}
+
+		auto data = std::make_shared<Data>();
+		data->shipTypes = shipTypes;
+		data->isLinear = true;
+
+		long long cells = 0;
+		for (size_t i = 0; i < shipTypes.size(); i++)
+		{
+			const ShipType& type = shipTypes[i];
+			bool fits = false;
+			for (const auto& orientation : type.shape.GetOrientations())
+			{
+				fits = fits || (orientation.height <= boardSize && orientation.width <= boardSize);
+			}
+			if (type.count <= 0 || !fits)
+			{
+				throw std::invalid_argument("Ship " + type.shape.ToString() + " does not fit on the board");
+			}
+
+			cells += static_cast<long long>(type.count) * type.shape.GetSize();
+			if (cells > static_cast<long long>(boardSize) * boardSize)
+			{
+				throw std::invalid_argument("Fleet does not fit on the board");
+			}
+
+			data->isLinear = data->isLinear && type.shape.IsLine();
+			data->ships.insert(data->ships.end(), type.count, static_cast<int>(i));
+		}
+		return data;
+	}
+
+	void FleetConfig::CheckPlacement() const
+	{
+		// Площади мало: корабли не касаются, поэтому флот проверяется настоящей расстановкой.
+		// Зерно постоянное, чтобы один и тот же файл всегда загружался одинаково
+		FleetGenerator generator(*this, 0);
+		if (!generator.Generate())
+		{
+			throw std::invalid_argument("Fleet cannot be placed on the board without ships touching");
+		}
+	}
+}
\ No newline at end of file
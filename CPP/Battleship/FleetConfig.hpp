@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <iostream>
+#include "ShipShape.hpp"
+#include "GameBoard.hpp"
+
+namespace Battleship {
+	// Правила партии: размер поля и состав флота. По умолчанию - классические
+	// поле 10x10 и корабли 4, 3, 3, 2, 2, 2, 1, 1, 1, 1. Данные неизменяемы
+	// и разделяются между копиями, поэтому конфигурацию дёшево хранить в каждом игроке
+	class FleetConfig
+	{
+	public:
+		// Тип корабля и сколько таких во флоте
+		struct ShipType
+		{
+			ShipShape shape;
+			int count;
+		};
+
+		// публичные: переопределение типом
+		using ShipTypesType = std::vector<ShipType>;
+		using ShipsType = std::vector<int>;		// индекс типа каждого корабля флота
+
+	public:
+		// конструкторы и деконструктор
+		FleetConfig();
+
+		// Бросает std::invalid_argument, если флот не помещается на поле. Расстановка без касаний
+		// проверяется пробным запуском FleetGenerator: флот, который генератор не расставил,
+		// нельзя сыграть, даже если расстановка есть (см. FleetGenerator::Generate)
+		FleetConfig(int boardSize, const ShipTypesType& shipTypes);
+		~FleetConfig() = default;
+
+		// публичные методы
+
+		// Загружает конфигурацию из потока. Формат строк:
+		//   board;<размер поля>
+		//   ship;<количество>;<форма в формате ShipShape::Parse>
+		// Пустые строки и строки, начинающиеся с '#', пропускаются. Бросает std::invalid_argument
+		// с номером строки; конфигурация меняется, только если весь поток корректен
+		void Load(std::istream& in);
+
+		// Загружает конфигурацию из файла; false, если файл не открылся
+		bool LoadFromFile(const std::string& path);
+
+		// Печатает размер поля и состав флота для правил игры
+		void Print(std::ostream& out) const;
+
+		// геттеры
+		int GetBoardSize() const { return m_boardSize; }
+		const ShipTypesType& GetShipTypes() const { return m_data->shipTypes; }
+		const ShipType& GetShipType(int index) const { return m_data->shipTypes[index]; }
+		const ShipsType& GetShips() const { return m_data->ships; }
+		bool IsLinear() const { return m_data->isLinear; }
+
+	private:
+		// Общие для всех копий данные
+		struct Data
+		{
+			ShipTypesType shipTypes;
+			ShipsType ships;
+			bool isLinear;		// все корабли прямые
+		};
+
+		// приватные методы
+		static std::shared_ptr<const Data> MakeData(int boardSize, const ShipTypesType& shipTypes);
+		void CheckPlacement() const;
+
+		// приватные переменные
+		int m_boardSize;
+		std::shared_ptr<const Data> m_data;
+	};
+}
\ No newline at end of file
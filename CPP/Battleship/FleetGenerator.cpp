@@ -0,0 +1,202 @@
+﻿#include "FleetGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace Battleship {
+	namespace {
+		// Номер n-го (с нуля) установленного бита
+		int SelectBit(BitBoard::RowType bits, int n)
+		{
+			for (int i = 0; i < n; i++)
+			{
+				bits &= bits - 1;
+			}
+			return std::countr_zero(bits);
+		}
+	}
+
+	FleetGenerator::FleetGenerator(const FleetConfig& fleet, SeedType seed)
+		: m_fleet(fleet)
+		, m_size(fleet.GetBoardSize())
+		, m_placements(fleet.GetShips().size())
+		, m_forbidden((fleet.GetShips().size() + 1) * fleet.GetBoardSize(), 0)
+		, m_stepsLeft(0)
+		, m_gen(seed)
+	{
+		const FleetConfig::ShipsType& ships = fleet.GetShips();
+		for (size_t i = 0; i < ships.size(); i++)
+		{
+			m_order.push_back(static_cast<int>(i));
+			m_placements[i] = { ships[i], 0, -1, -1 };
+		}
+
+		// Большие корабли ставятся первыми: для них меньше мест, и откатов почти не бывает
+		std::stable_sort(m_order.begin(), m_order.end(), [&fleet, &ships](int a, int b) {
+			return fleet.GetShipType(ships[a]).shape.GetSize() > fleet.GetShipType(ships[b]).shape.GetSize();
+		});
+
+		// На каждом уровне поиска своя линия мест на каждую пару (вариант формы, верхняя строка рамки)
+		m_lineOffsets.push_back(0);
+		for (int index : m_order)
+		{
+			int lines = 0;
+			for (const auto& orientation : fleet.GetShipType(ships[index]).shape.GetOrientations())
+			{
+				lines += GetLineCount(orientation);
+			}
+			m_lineOffsets.push_back(m_lineOffsets.back() + lines);
+		}
+		m_starts.resize(m_lineOffsets.back());
+		m_counts.resize(m_lineOffsets.back());
+	}
+
+	bool FleetGenerator::Generate()
+	{
+		std::fill(m_forbidden.begin(), m_forbidden.begin() + m_size, 0);
+		for (int attempt = 0; attempt < MAX_RESTARTS; attempt++)
+		{
+			m_stepsLeft = MAX_STEPS;
+			if (PlaceFrom(0))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool FleetGenerator::PlaceFleet(GameBoard& board)
+	{
+		if (board.GetSize() != m_size || !Generate())
+		{
+			return false;
+		}
+		return Apply(m_fleet, m_placements, board);
+	}
+
+	bool FleetGenerator::Apply(const FleetConfig& fleet, const PlacementsType& placements, GameBoard& board)
+	{
+		for (const auto& placement : placements)
+		{
+			if (!board.PlaceShip(MakeShip(fleet, placement)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	Ship FleetGenerator::MakeShip(const FleetConfig& fleet, const Placement& placement)
+	{
+		return Ship(fleet.GetShipType(placement.type).shape.Place(placement.orientation, placement.row, placement.col));
+	}
+
+	bool FleetGenerator::PlaceFrom(int depth)
+	{
+		if (depth == static_cast<int>(m_order.size()))
+		{
+			return true;
+		}
+
+		Placement& placement = m_placements[m_order[depth]];
+		const ShipShape::OrientationsType& orientations = m_fleet.GetShipType(placement.type).shape.GetOrientations();
+		const BitBoard::RowType* forbidden = &m_forbidden[depth * m_size];
+		BitBoard::RowType* next = &m_forbidden[(depth + 1) * m_size];
+		BitBoard::RowType* starts = m_starts.data() + m_lineOffsets[depth];
+		int* counts = m_counts.data() + m_lineOffsets[depth];
+
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(m_size);
+		std::array<BitBoard::RowType, BitBoard::MAX_SIZE> free;
+		for (int row = 0; row < m_size; row++)
+		{
+			free[row] = ~forbidden[row] & rowMask;
+		}
+
+		// Бит c линии (вариант, row) остаётся, если свободны все клетки варианта с углом рамки в (row, c)
+		int line = 0;
+		int total = 0;
+		for (const auto& orientation : orientations)
+		{
+			int lines = GetLineCount(orientation);
+			for (int row = 0; row < lines; row++, line++)
+			{
+				BitBoard::RowType bits = rowMask;
+				for (const auto& cell : orientation.cells)
+				{
+					bits &= free[row + cell.first] >> cell.second;
+				}
+				starts[line] = bits;
+				counts[line] = std::popcount(bits);
+				total += counts[line];
+			}
+		}
+
+		while (total > 0 && m_stepsLeft-- > 0)
+		{
+			// Равновероятный выбор среди оставшихся мест
+			int rank = static_cast<int>((static_cast<std::uint64_t>(m_gen()) * total) >> 32);
+			line = 0;
+			while (rank >= counts[line])
+			{
+				rank -= counts[line];
+				line++;
+			}
+
+			// Номер линии - вариант формы и верхняя строка рамки
+			placement.orientation = 0;
+			placement.row = line;
+			while (placement.row >= GetLineCount(orientations[placement.orientation]))
+			{
+				placement.row -= GetLineCount(orientations[placement.orientation]);
+				placement.orientation++;
+			}
+			placement.col = SelectBit(starts[line], rank);
+
+			std::copy(forbidden, forbidden + m_size, next);
+			MarkForbidden(next, placement);
+			if (PlaceFrom(depth + 1))
+			{
+				return true;
+			}
+
+			// Место не подошло: убираем его из выбора
+			starts[line] &= ~(BitBoard::RowType(1) << placement.col);
+			counts[line]--;
+			total--;
+		}
+		return false;
+	}
+
+	int FleetGenerator::GetLineCount(const ShipShape::Orientation& orientation) const
+	{
+		// Вариант, не влезающий в поле, мест не имеет
+		if (orientation.height > m_size || orientation.width > m_size)
+		{
+			return 0;
+		}
+		return m_size - orientation.height + 1;
+	}
+
+	void FleetGenerator::MarkForbidden(BitBoard::RowType* forbidden, const Placement& placement) const
+	{
+		// Корабль вместе с соседними клетками: каждая строка корабля, расширенная на бит в обе стороны,
+		// запрещается в своей строке и в соседних
+		const ShipShape::Orientation& orientation =
+			m_fleet.GetShipType(placement.type).shape.GetOrientations()[placement.orientation];
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(m_size);
+
+		for (int i = 0; i < orientation.height; i++)
+		{
+			BitBoard::RowType bits = orientation.rows[i] << placement.col;
+			bits = (bits | (bits << 1) | (bits >> 1)) & rowMask;
+
+			int row = placement.row + i;
+			int first = std::max(row - 1, 0);
+			int last = std::min(row + 1, m_size - 1);
+			for (int r = first; r <= last; r++)
+			{
+				forbidden[r] |= bits;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+﻿#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "GameBoard.hpp"
+#include "FleetConfig.hpp"
+#include "BitBoard.hpp"
+#include "RandomEngine.hpp"
+
+namespace Battleship {
+	// Генератор случайной расстановки флота. Для каждого корабля перечисляет все
+	// допустимые места всех вариантов его формы по маске запретных клеток и выбирает
+	// одно равновероятно; если следующему кораблю некуда встать, откатывается
+	// и пробует другое место. Число шагов поиска ограничено; исчерпав его, генератор
+	// начинает заново с другими случайными выборами, и после MAX_RESTARTS попыток сдаётся
+	class FleetGenerator
+	{
+	public:
+		static const int MAX_STEPS = 10000;
+		static const int MAX_RESTARTS = 8;
+
+		// публичные: переопределение типом
+		using SeedType = std::uint32_t;
+
+		// Место одного корабля: вариант формы и левый верхний угол его рамки
+		struct Placement
+		{
+			int type;			// индекс типа в FleetConfig
+			int orientation;	// индекс в ShipShape::GetOrientations
+			int row;
+			int col;
+		};
+
+		using PlacementsType = std::vector<Placement>;
+
+	public:
+		// конструкторы и деконструктор
+		FleetGenerator(const FleetConfig& fleet, SeedType seed);
+		~FleetGenerator() = default;
+
+		// публичные методы
+
+		// Строит новую расстановку. false - расстановка не найдена за MAX_RESTARTS попыток
+		// по MAX_STEPS шагов: флот не помещается либо помещается так тесно, что случайный
+		// поиск его не находит (например, 25 одиночных кораблей на поле 10x10).
+		// Поиск неполный, поэтому false не доказывает, что расстановки нет
+		bool Generate();
+
+		// Строит расстановку и ставит корабли на пустое поле
+		bool PlaceFleet(GameBoard& board);
+
+		// Ставит корабли готовой расстановки на пустое поле
+		static bool Apply(const FleetConfig& fleet, const PlacementsType& placements, GameBoard& board);
+
+		// Корабль, стоящий на месте placement
+		static Ship MakeShip(const FleetConfig& fleet, const Placement& placement);
+
+		// геттеры
+		const FleetConfig& GetFleet() const { return m_fleet; }
+		const PlacementsType& GetPlacements() const { return m_placements; }
+
+	private:
+		// приватные методы
+		bool PlaceFrom(int depth);
+		int GetLineCount(const ShipShape::Orientation& orientation) const;
+		void MarkForbidden(BitBoard::RowType* forbidden, const Placement& placement) const;
+
+		// приватные переменные
+		FleetConfig m_fleet;
+		int m_size;
+		std::vector<int> m_order;						// индексы кораблей по убыванию числа клеток
+		PlacementsType m_placements;					// в порядке FleetConfig::GetShips
+		std::vector<BitBoard::RowType> m_forbidden;	// строки маски запретных клеток, m_size слов на уровень поиска
+		std::vector<int> m_lineOffsets;				// начало линий мест каждого уровня поиска в m_starts
+		std::vector<BitBoard::RowType> m_starts;		// допустимые начала мест по линиям (вариант формы, строка)
+		std::vector<int> m_counts;						// число начал в каждой линии
+		int m_stepsLeft;
+		RandomEngine m_gen;
+	};
+}
\ No newline at end of file
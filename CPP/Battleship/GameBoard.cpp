@@ -1,148 +1,136 @@
 ﻿#include "GameBoard.hpp"
 #include <algorithm>
+#include <stdexcept>
 
 
 namespace Battleship {
 	GameBoard::GameBoard(int size)
 		: m_size(size)
+		, m_occupied(size)
+		, m_forbidden(size)
+		, m_shots(size)
+		, m_hits(size)
 	{
 	}
 
-	bool GameBoard::PlaceShip(const Ship& ship)
+	bool GameBoard::IsOnBoard(std::pair<int, int> coord) const
 	{
-		// Проверка на выход за границы
-		for (const auto& coord : ship.GetCoordinates())
+		return coord.first >= 0 && coord.second >= 0 && coord.first < m_size && coord.second < m_size;
+	}
+
+	bool GameBoard::CanPlaceShip(const Ship::CoordinatesType& coordinates) const
+	{
+		if (coordinates.empty())
+		{
+			return false;
+		}
+
+		// Все клетки на поле и не задевают другие корабли вместе с соседними с ними клетками
+		for (const auto& coord : coordinates)
 		{
-			if (coord.first < 0 || coord.first >= m_size ||
-				coord.second < 0 || coord.second >= m_size)
+			if (!IsOnBoard(coord) || m_forbidden.Test(coord.first, coord.second))
 			{
 				return false;
 			}
 		}
+		return true;
+	}
 
-		// Проверка на пересечение с другими кораблями
-		for (const auto& existingShip : m_ships)
+	bool GameBoard::PlaceShip(const Ship& ship)
+	{
+		if (!CanPlaceShip(ship.GetCoordinates()))
 		{
-			for (const auto& existingCoord : existingShip.GetCoordinates())
-			{
-				for (const auto& newCoord : ship.GetCoordinates())
-				{
-					// Проверка самой координаты и соседних клеток
-					for (int i = -1; i <= 1; i++)
-					{
-						for (int j = -1; j <= 1; j++)
-						{
-							if (existingCoord.first + i == newCoord.first &&
-								existingCoord.second + j == newCoord.second)
-							{
-								return false;
-							}
-						}
-					}
-				}
-			}
+			return false;
+		}
+
+		BitBoard mask(m_size);
+		for (const auto& coord : ship.GetCoordinates())
+		{
+			mask.Set(coord.first, coord.second);
+		}
+
+		// Клетки корабля не должны повторяться
+		if (mask.Count() != ship.GetSize())
+		{
+			return false;
 		}
 
 		m_ships.push_back(ship);
+		m_shipMasks.push_back(mask);
+		m_occupied |= mask;
+		m_forbidden |= mask.Dilate();
 		return true;
 	}
 
 	Ship::ShotResult GameBoard::ReceiveShot(std::pair<int, int> coord)
 	{
+		int row = coord.first;
+		int col = coord.second;
+
+		// Битовые плоскости не проверяют границы: чужой ход не должен писать за поле
+		if (!IsOnBoard(coord))
+		{
+			throw std::out_of_range("Shot outside the board: (" + std::to_string(row) + ", " + std::to_string(col) + ")");
+		}
+
 		// Проверка на повторный выстрел
-		if (m_shots.find(coord) != m_shots.end())
+		if (m_shots.Test(row, col))
 		{
 			return Ship::ShotResult::eAlreadyShot;
 		}
 
-		m_shots.insert(coord);
+		m_shots.Set(row, col);
 
 		// Проверка попадания
-		for (auto& ship : m_ships)
+		if (!m_occupied.Test(row, col))
 		{
-			if (ship.TakeHit(coord))
+			return Ship::ShotResult::eMiss;
+		}
+
+		m_hits.Set(row, col);
+
+		// Ищем подбитый корабль по его маске
+		for (size_t i = 0; i < m_shipMasks.size(); i++)
+		{
+			if (m_shipMasks[i].Test(row, col))
 			{
-				if (ship.IsSunk())
+				m_ships[i].TakeHit(coord);
+				if (m_shipMasks[i].IsSubsetOf(m_hits))
 				{
 					return Ship::ShotResult::eSunk;
 				}
-				return Ship::ShotResult::eHit;
+				break;
 			}
 		}
-
-		m_misses.push_back(coord);
-		return Ship::ShotResult::eMiss;
+		return Ship::ShotResult::eHit;
 	}
 
 	bool GameBoard::IsAllShipsSunk() const
 	{
-		for (const auto& ship : m_ships)
-		{
-			if (!ship.IsSunk())
-			{
-				return false;
-			}
-		}
-		return true;
+		return m_occupied.IsSubsetOf(m_hits);
 	}
 
 	GameBoard::BoardStateType GameBoard::GetVisibleState(bool forOwner) const
 	{
 		BoardStateType state(m_size, std::vector<char>(m_size, '.'));
 
-		// Всегда показываем промахи
-		for (const auto& miss : m_misses)
+		for (int i = 0; i < m_size; i++)
 		{
-			state[miss.first][miss.second] = 'O';
-		}
-
-		// Всегда показываем попадания
-		for (const auto& ship : m_ships)
-		{
-			for (const auto& coord : ship.GetCoordinates())
+			for (int j = 0; j < m_size; j++)
 			{
-				if (m_shots.find(coord) != m_shots.end())
+				if (m_shots.Test(i, j))
 				{
-					state[coord.first][coord.second] = 'X';
+					// Всегда показываем промахи и попадания
+					state[i][j] = m_occupied.Test(i, j) ? 'X' : 'O';
 				}
-			}
-		}
-
-		// Показываем корабли ТОЛЬКО если это поле владельца
-		if (forOwner)
-		{
-			for (const auto& ship : m_ships)
-			{
-				for (const auto& coord : ship.GetCoordinates())
+				else if (forOwner && m_occupied.Test(i, j))
 				{
-					// Показываем неподбитые части кораблей
-					if (m_shots.find(coord) == m_shots.end())
-					{
-						state[coord.first][coord.second] = 'S';
-					}
+					// Показываем неподбитые части кораблей ТОЛЬКО если это поле владельца
+					state[i][j] = 'S';
 				}
 			}
 		}
 
 		return state;
 	}
-
-	// Кастомные размеры кораблей в зависимости от размера поля
-	GameBoard::ShipSizesType GameBoard::MakeShipSizes(std::array < std::pair<int, int>, 4> shipConfig)
-	{
-		// Формируем вектор размеров кораблей
-		ShipSizesType sizes;
-		for (const auto& pair : shipConfig)
-		{
-			int shipLength = pair.first;
-			int shipCount = pair.second;
-
-			for (int i = 0; i < shipCount; i++)
-			{
-				sizes.push_back(shipLength);
-			}
-		}
-
-		return sizes;
-	}
 }
\ No newline at end of file
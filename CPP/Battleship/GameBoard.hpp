@@ -1,27 +1,21 @@
 ﻿#pragma once
 
 #include <vector>
-#include <set>
 #include <utility>
 #include <string>
-#include <array>
 #include "Ship.hpp"
+#include "BitBoard.hpp"
 
 namespace Battleship {
 	class GameBoard
 	{
 	public:
 		static const int DEFAULT_BOARD_SIZE = 10;
-		static constexpr std::array<std::pair<int, int>, 4> DEFAULT_SHIP_CONFIG = {
-			{{ 4, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 }}
-		};
 
 		// публичные: переопределение типом
 		using ShipsType = std::vector<Ship>;
-		using ShotsType = std::set<std::pair<int, int>>;
-		using MissesType = std::vector<std::pair<int, int>>;
+		using ShipMasksType = std::vector<BitBoard>;
 		using BoardStateType = std::vector<std::vector<char>>;
-		using ShipSizesType = std::vector<int>;
 
 	public:
 		// конструкторы и деконструктор
@@ -29,21 +23,30 @@ namespace Battleship {
 		~GameBoard() = default;
 
 		// публичные методы
+		bool IsOnBoard(std::pair<int, int> coord) const;
+		bool CanPlaceShip(const Ship::CoordinatesType& coordinates) const;
 		bool PlaceShip(const Ship& ship);
+		// Выстрел за пределы поля - std::out_of_range
 		Ship::ShotResult ReceiveShot(std::pair<int, int> coord);
 		bool IsAllShipsSunk() const;
 		BoardStateType GetVisibleState(bool forOwner) const;
-		static ShipSizesType MakeShipSizes(std::array < std::pair<int, int>, 4> shipConfig);
 
 		// геттеры
 		int GetSize() const { return m_size; }
 		const ShipsType& GetShips() const { return m_ships; }
+		const BitBoard& GetOccupied() const { return m_occupied; }
+		const BitBoard& GetForbidden() const { return m_forbidden; }
+		const BitBoard& GetShots() const { return m_shots; }
+		const BitBoard& GetHits() const { return m_hits; }
 
 	private:
 		// приватные переменные
 		int m_size;
 		ShipsType m_ships;
-		ShotsType m_shots;
-		MissesType m_misses;
+		ShipMasksType m_shipMasks;	// клетки каждого корабля, в порядке m_ships
+		BitBoard m_occupied;		// клетки всех кораблей
+		BitBoard m_forbidden;		// клетки кораблей вместе с соседними: сюда ставить нельзя
+		BitBoard m_shots;			// все выстрелы
+		BitBoard m_hits;			// выстрелы, попавшие в корабли
 	};
 }
\ No newline at end of file
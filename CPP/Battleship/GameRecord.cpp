@@ -0,0 +1,212 @@
+﻿#include "GameRecord.hpp"
+#include <stdexcept>
+
+namespace Battleship {
+	namespace {
+		void ThrowCorrupted()
+		{
+			throw std::runtime_error("Corrupted game record");
+		}
+
+		std::uint64_t ReadValue(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t maxValue)
+		{
+			std::uint64_t value = 0;
+			if (!GameRecord::ReadVarint(data, end, value) || value > maxValue)
+			{
+				ThrowCorrupted();
+			}
+			return value;
+		}
+	}
+
+	void GameRecord::Serialize(BytesType& out) const
+	{
+		WriteVarint(out, static_cast<std::uint64_t>(game));
+		WriteVarint(out, static_cast<std::uint64_t>(boardSize));
+		for (const auto& name : names)
+		{
+			WriteVarint(out, name.size());
+			out.insert(out.end(), name.begin(), name.end());
+		}
+		for (std::uint32_t seed : seeds)
+		{
+			WriteVarint(out, seed);
+		}
+
+		// Маски кораблей по битам, клетки подряд по строкам: 13 байт на поле 10x10
+		for (const auto& layout : layouts)
+		{
+			std::uint8_t byte = 0;
+			int bit = 0;
+			for (int row = 0; row < boardSize; row++)
+			{
+				for (int col = 0; col < boardSize; col++)
+				{
+					byte |= static_cast<std::uint8_t>(layout.Test(row, col)) << bit;
+					if (++bit == 8)
+					{
+						out.push_back(byte);
+						byte = 0;
+						bit = 0;
+					}
+				}
+			}
+			if (bit != 0)
+			{
+				out.push_back(byte);
+			}
+		}
+
+		// Клетка выстрела до поля 11x11 занимает байт, иначе не больше двух
+		WriteVarint(out, shots.size());
+		for (int shot : shots)
+		{
+			WriteVarint(out, static_cast<std::uint64_t>(shot));
+		}
+		out.push_back(static_cast<std::uint8_t>(winner + 1));
+	}
+
+	void GameRecord::Deserialize(const std::uint8_t* data, size_t size)
+	{
+		const std::uint8_t* end = data + size;
+
+		game = static_cast<long long>(ReadValue(data, end, INT64_MAX));
+		boardSize = static_cast<int>(ReadValue(data, end, BitBoard::MAX_SIZE));
+		if (boardSize == 0)
+		{
+			ThrowCorrupted();
+		}
+		for (auto& name : names)
+		{
+			size_t length = static_cast<size_t>(ReadValue(data, end, static_cast<std::uint64_t>(end - data)));
+			name.assign(reinterpret_cast<const char*>(data), length);
+			data += length;
+		}
+		for (auto& seed : seeds)
+		{
+			seed = static_cast<std::uint32_t>(ReadValue(data, end, UINT32_MAX));
+		}
+
+		const int cells = boardSize * boardSize;
+		const size_t layoutBytes = (static_cast<size_t>(cells) + 7) / 8;
+		for (auto& layout : layouts)
+		{
+			if (static_cast<size_t>(end - data) < layoutBytes)
+			{
+				ThrowCorrupted();
+			}
+			layout = BitBoard(boardSize);
+			for (int cell = 0; cell < cells; cell++)
+			{
+				if ((data[cell / 8] >> (cell % 8)) & 1)
+				{
+					layout.Set(cell / boardSize, cell % boardSize);
+				}
+			}
+			data += layoutBytes;
+		}
+
+		size_t count = static_cast<size_t>(ReadValue(data, end, static_cast<std::uint64_t>(end - data)));
+		shots.resize(count);
+		for (auto& shot : shots)
+		{
+			shot = static_cast<int>(ReadValue(data, end, cells - 1));
+		}
+
+		// Итог - последний байт записи
+		if (end - data != 1 || *data > 2)
+		{
+			ThrowCorrupted();
+		}
+		winner = static_cast<int>(*data) - 1;
+	}
+
+	void GameRecord::WriteVarint(BytesType& out, std::uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+			value >>= 7;
+		}
+		out.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	bool GameRecord::ReadVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 64 && data < end; shift += 7)
+		{
+			std::uint8_t byte = *data++;
+			value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	GameRecordReader::GameRecordReader(const std::string& path)
+		: m_file(path, std::ios::binary)
+	{
+		if (!m_file)
+		{
+			throw std::runtime_error("Cannot open file: " + path);
+		}
+
+		std::uint8_t header[5] = {};
+		m_file.read(reinterpret_cast<char*>(header), sizeof(header));
+		std::uint32_t magic = header[0] | header[1] << 8 | header[2] << 16 | static_cast<std::uint32_t>(header[3]) << 24;
+		if (!m_file || magic != GameRecord::FILE_MAGIC || header[4] != GameRecord::FILE_VERSION)
+		{
+			throw std::runtime_error("Not a game record file: " + path);
+		}
+	}
+
+	bool GameRecordReader::Next(GameRecord& record)
+	{
+		std::uint64_t length = 0;
+		if (!ReadLength(length))
+		{
+			return false;
+		}
+		if (length > MAX_RECORD_SIZE)
+		{
+			ThrowCorrupted();
+		}
+
+		m_buffer.resize(static_cast<size_t>(length));
+		m_file.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(length));
+		if (static_cast<std::uint64_t>(m_file.gcount()) != length)
+		{
+			ThrowCorrupted();
+		}
+		record.Deserialize(m_buffer.data(), m_buffer.size());
+		return true;
+	}
+
+	bool GameRecordReader::ReadLength(std::uint64_t& length)
+	{
+		// Конец файла допустим только перед длиной записи
+		length = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			int byte = m_file.get();
+			if (byte == std::char_traits<char>::eof())
+			{
+				if (shift != 0)
+				{
+					ThrowCorrupted();
+				}
+				return false;
+			}
+			length |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+		ThrowCorrupted();
+		return false;
+	}
+}
\ No newline at end of file
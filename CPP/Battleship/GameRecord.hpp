@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BitBoard.hpp"
+
+namespace Battleship {
+	// Запись партии: расстановки, выстрелы по порядку, итог и зёрна генераторов игроков.
+	// Игроки хранятся в порядке хода: players[0] стреляет первым.
+	// Корабли не касаются друг друга, поэтому расстановку полностью задаёт маска клеток кораблей,
+	// а кто стрелял и чем кончился каждый выстрел, восстанавливает GameReplay
+	struct GameRecord
+	{
+		// публичные: переопределение типом
+		using BytesType = std::vector<std::uint8_t>;
+		using ShotsType = std::vector<int>;
+
+		// Заголовок файла записей
+		static const std::uint32_t FILE_MAGIC = 0x52475342;	// "BSGR"
+		static const std::uint8_t FILE_VERSION = 1;
+
+		long long game;							// номер партии в турнире
+		int boardSize;
+		std::array<std::string, 2> names;		// игроки или стратегии "расстановка/стрельба"
+		std::array<std::uint32_t, 2> seeds;		// зёрна генераторов игроков
+		std::array<BitBoard, 2> layouts;		// клетки кораблей каждого игрока
+		ShotsType shots;						// клетки выстрелов row * boardSize + col, оба игрока по очереди хода
+		int winner;								// 0, 1 или -1 - ничья по лимиту выстрелов
+
+		// Дописывает запись в out без длины
+		void Serialize(BytesType& out) const;
+
+		// Читает запись из size байт. Бросает std::runtime_error, если данные повреждены
+		void Deserialize(const std::uint8_t* data, size_t size);
+
+		// Числа переменной длины: по 7 бит в байте, старший бит - есть продолжение
+		static void WriteVarint(BytesType& out, std::uint64_t value);
+		static bool ReadVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& value);
+	};
+
+	// Последовательное чтение файла записей
+	class GameRecordReader
+	{
+	public:
+		// Больше не бывает даже на поле 64x64: длина сверх этого - признак повреждения
+		static const size_t MAX_RECORD_SIZE = 1 << 20;
+
+	public:
+		// конструкторы и деконструктор
+		// Бросает std::runtime_error, если файл не открывается или это не файл записей
+		GameRecordReader(const std::string& path);
+		~GameRecordReader() = default;
+
+		// публичные методы
+
+		// Следующая запись; false в конце файла
+		bool Next(GameRecord& record);
+
+	private:
+		// приватные методы
+		bool ReadLength(std::uint64_t& length);
+
+	private:
+		// приватные переменные
+		std::ifstream m_file;
+		GameRecord::BytesType m_buffer;
+	};
+}
\ No newline at end of file
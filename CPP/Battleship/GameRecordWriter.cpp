@@ -0,0 +1,153 @@
+﻿#include "GameRecordWriter.hpp"
+#include <stdexcept>
+
+namespace Battleship {
+	GameRecordWriter::Batch::Batch(GameRecordWriter& writer)
+		: m_writer(writer)
+		, m_count(0)
+	{
+		m_block.reserve(BLOCK_SIZE + BLOCK_SIZE / 4);
+	}
+
+	GameRecordWriter::Batch::~Batch()
+	{
+		// Исключение из деструктора завершило бы программу; потерю записей сообщает Close
+		try
+		{
+			Flush();
+		}
+		catch (...)
+		{
+			m_writer.MarkFailed();
+		}
+	}
+
+	void GameRecordWriter::Batch::Add(const GameRecord& record)
+	{
+		// Запись в файле предваряется своей длиной: по ней читатель пропускает запись целиком
+		m_record.clear();
+		record.Serialize(m_record);
+		GameRecord::WriteVarint(m_block, m_record.size());
+		m_block.insert(m_block.end(), m_record.begin(), m_record.end());
+		m_count++;
+
+		if (m_block.size() >= BLOCK_SIZE)
+		{
+			Flush();
+		}
+	}
+
+	void GameRecordWriter::Batch::Flush()
+	{
+		if (m_count == 0)
+		{
+			return;
+		}
+
+		m_writer.Submit(std::move(m_block), m_count);
+		m_block = GameRecord::BytesType();
+		m_block.reserve(BLOCK_SIZE + BLOCK_SIZE / 4);
+		m_count = 0;
+	}
+
+	GameRecordWriter::GameRecordWriter(const std::string& path)
+		: m_file(path, std::ios::binary | std::ios::trunc)
+		, m_count(0)
+		, m_closing(false)
+		, m_closed(false)
+		, m_failed(false)
+	{
+		if (!m_file)
+		{
+			throw std::runtime_error("Cannot open file: " + path);
+		}
+
+		const std::uint32_t magic = GameRecord::FILE_MAGIC;
+		const char header[5] = {
+			static_cast<char>(magic & 0xFF), static_cast<char>(magic >> 8 & 0xFF),
+			static_cast<char>(magic >> 16 & 0xFF), static_cast<char>(magic >> 24),
+			static_cast<char>(GameRecord::FILE_VERSION)
+		};
+		m_file.write(header, sizeof(header));
+
+		m_thread = std::thread(&GameRecordWriter::Run, this);
+	}
+
+	GameRecordWriter::~GameRecordWriter()
+	{
+		Close();
+	}
+
+	void GameRecordWriter::Submit(GameRecord::BytesType&& block, long long count)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_hasRoom.wait(lock, [this] { return m_pending.size() < MAX_PENDING_BLOCKS || m_closing; });
+		if (m_closing)
+		{
+			throw std::logic_error("GameRecordWriter is closed");
+		}
+
+		m_pending.push_back(std::move(block));
+		m_count += count;
+		m_hasBlocks.notify_one();
+	}
+
+	bool GameRecordWriter::Close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_closed)
+			{
+				return !m_failed;
+			}
+			m_closing = true;
+			m_closed = true;
+		}
+		m_hasBlocks.notify_one();
+		m_hasRoom.notify_all();
+		m_thread.join();
+
+		m_file.close();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_failed = m_failed || m_file.fail();
+		return !m_failed;
+	}
+
+	long long GameRecordWriter::GetRecordCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_count;
+	}
+
+	void GameRecordWriter::Run()
+	{
+		GameRecord::BytesType block;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_hasBlocks.wait(lock, [this] { return !m_pending.empty() || m_closing; });
+				if (m_pending.empty())
+				{
+					break;
+				}
+				block = std::move(m_pending.front());
+				m_pending.pop_front();
+			}
+			m_hasRoom.notify_one();
+
+			// Файл трогает только этот поток, блокировка на время записи не нужна
+			m_file.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+		}
+
+		m_file.flush();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_failed = m_failed || !m_file;
+	}
+
+	void GameRecordWriter::MarkFailed()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_failed = true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+﻿#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "GameRecord.hpp"
+
+namespace Battleship {
+	// Запись партий в файл фоновым потоком. Потоки симуляции копят записи в своих пакетах
+	// (Batch) и отдают их блоками; на диск блоки пишет отдельный поток, так что симуляция
+	// ждёт только если диск не успевает и очередь заполнена
+	class GameRecordWriter
+	{
+	public:
+		// Размер блока, после которого пакет отдаётся на запись
+		static const size_t BLOCK_SIZE = 1 << 16;
+
+		// Блоков в очереди, после которых производители ждут диск
+		static const size_t MAX_PENDING_BLOCKS = 64;
+
+		// Пакет записей одного потока; остаток отдаётся в деструкторе. Деструктор не бросает:
+		// если писатель уже закрыт, остаток теряется, и Close (в том числе повторный) возвращает false.
+		// Flush, вызванный явно, бросает std::logic_error
+		class Batch
+		{
+		public:
+			// конструкторы и деконструктор
+			Batch(GameRecordWriter& writer);
+			~Batch();
+
+			Batch(const Batch&) = delete;
+			Batch& operator=(const Batch&) = delete;
+
+			// публичные методы
+			void Add(const GameRecord& record);
+			void Flush();
+
+		private:
+			// приватные переменные
+			GameRecordWriter& m_writer;
+			GameRecord::BytesType m_block;
+			GameRecord::BytesType m_record;		// сериализованная запись до того, как известна её длина
+			long long m_count;
+		};
+
+	public:
+		// конструкторы и деконструктор
+		// Бросает std::runtime_error, если файл не открывается
+		GameRecordWriter(const std::string& path);
+		~GameRecordWriter();
+
+		GameRecordWriter(const GameRecordWriter&) = delete;
+		GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+
+		// публичные методы
+
+		// Ставит блок в очередь записи; ждёт, если очередь полна
+		void Submit(GameRecord::BytesType&& block, long long count);
+
+		// Дописывает очередь и закрывает файл. false, если запись на диск не удалась
+		bool Close();
+
+		// геттеры
+		long long GetRecordCount() const;
+
+	private:
+		// приватные методы
+		void Run();
+		void MarkFailed();
+
+	private:
+		// приватные переменные
+		std::ofstream m_file;
+		std::deque<GameRecord::BytesType> m_pending;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_hasBlocks;
+		std::condition_variable m_hasRoom;
+		long long m_count;
+		bool m_closing;
+		bool m_closed;
+		bool m_failed;
+		std::thread m_thread;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+﻿#include "GameReplay.hpp"
+#include <stdexcept>
+
+namespace Battleship {
+	GameReplay::GameReplay(const GameRecord& record)
+		: m_record(record)
+		, m_start{ MakeBoard(record.layouts[0]), MakeBoard(record.layouts[1]) }
+		, m_boards(m_start)
+		, m_turn(0)
+	{
+		// Очерёдность по правилам MatchEngine: попавший стреляет ещё раз, промахнувшийся передаёт ход
+		int shooter = 0;
+		int winner = -1;
+		m_turns.reserve(record.shots.size());
+		for (int shot : record.shots)
+		{
+			if (winner >= 0)
+			{
+				throw std::invalid_argument("Game record has shots after the end of the game");
+			}
+
+			Turn turn = { shooter, { shot / record.boardSize, shot % record.boardSize }, Ship::ShotResult::eMiss };
+			turn.result = m_boards[1 - shooter].ReceiveShot(turn.move);
+			m_turns.push_back(turn);
+
+			if (turn.result == Ship::ShotResult::eHit || turn.result == Ship::ShotResult::eSunk)
+			{
+				if (m_boards[1 - shooter].IsAllShipsSunk())
+				{
+					winner = shooter;
+				}
+				continue;
+			}
+			shooter = 1 - shooter;
+		}
+
+		if (winner != record.winner)
+		{
+			throw std::invalid_argument("Game record winner does not match its shots");
+		}
+
+		m_turn = GetTurnCount();
+	}
+
+	void GameReplay::SeekTo(int turn)
+	{
+		if (turn < 0 || turn > GetTurnCount())
+		{
+			throw std::out_of_range("Turn is out of range");
+		}
+
+		// Назад - с расстановки, вперёд - от текущего хода
+		if (turn < m_turn)
+		{
+			m_boards = m_start;
+			m_turn = 0;
+		}
+		for (; m_turn < turn; m_turn++)
+		{
+			Apply(m_turns[m_turn]);
+		}
+	}
+
+	GameBoard GameReplay::MakeBoard(const BitBoard& layout)
+	{
+		// Корабли - связные по сторонам группы клеток маски: разные корабли не касаются даже углами
+		const int size = layout.GetSize();
+		GameBoard board(size);
+		BitBoard visited(size);
+		for (int row = 0; row < size; row++)
+		{
+			for (int col = 0; col < size; col++)
+			{
+				if (!layout.Test(row, col) || visited.Test(row, col))
+				{
+					continue;
+				}
+
+				Ship::CoordinatesType cells = { { row, col } };
+				visited.Set(row, col);
+				for (size_t i = 0; i < cells.size(); i++)
+				{
+					const int dr[] = { -1, 1, 0, 0 };
+					const int dc[] = { 0, 0, -1, 1 };
+					for (int d = 0; d < 4; d++)
+					{
+						int r = cells[i].first + dr[d];
+						int c = cells[i].second + dc[d];
+						if (r >= 0 && c >= 0 && r < size && c < size && layout.Test(r, c) && !visited.Test(r, c))
+						{
+							visited.Set(r, c);
+							cells.push_back({ r, c });
+						}
+					}
+				}
+
+				if (!board.PlaceShip(Ship(cells)))
+				{
+					throw std::invalid_argument("Game record has touching ships");
+				}
+			}
+		}
+		return board;
+	}
+
+	void GameReplay::Apply(const Turn& turn)
+	{
+		m_boards[1 - turn.shooter].ReceiveShot(turn.move);
+	}
+}
\ No newline at end of file
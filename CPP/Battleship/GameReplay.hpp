@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include <array>
+#include <vector>
+#include "GameRecord.hpp"
+#include "GameBoard.hpp"
+
+namespace Battleship {
+	// Повтор записанной партии: восстанавливает корабли по маскам, кто стрелял и результат
+	// каждого выстрела, и поля игроков после любого хода
+	class GameReplay
+	{
+	public:
+		// публичные: переопределение типом
+		using MoveType = std::pair<int, int>;
+
+		// Выстрел партии
+		struct Turn
+		{
+			int shooter;				// 0 или 1, как в GameRecord::names
+			MoveType move;
+			Ship::ShotResult result;
+		};
+
+		using TurnsType = std::vector<Turn>;
+
+	public:
+		// конструкторы и деконструктор
+		// Бросает std::invalid_argument, если запись противоречива: корабли касаются,
+		// выстрелы продолжаются после конца партии или итог не совпадает с записанным
+		GameReplay(const GameRecord& record);
+		~GameReplay() = default;
+
+		// публичные методы
+
+		// Поля после первых turn выстрелов (0 - сразу после расстановки)
+		void SeekTo(int turn);
+
+		// геттеры
+		const GameRecord& GetRecord() const { return m_record; }
+		int GetTurnCount() const { return static_cast<int>(m_turns.size()); }
+		int GetTurn() const { return m_turn; }
+		const Turn& GetTurnInfo(int turn) const { return m_turns[turn]; }
+		const GameBoard& GetBoard(int player) const { return m_boards[player]; }
+
+	private:
+		// приватные методы
+		static GameBoard MakeBoard(const BitBoard& layout);
+		void Apply(const Turn& turn);
+
+	private:
+		// приватные переменные
+		GameRecord m_record;
+		TurnsType m_turns;
+		std::array<GameBoard, 2> m_start;	// поля сразу после расстановки
+		std::array<GameBoard, 2> m_boards;	// поля после m_turn выстрелов
+		int m_turn;
+	};
+}
\ No newline at end of file
@@ -1,14 +1,15 @@
 ﻿#include "HumanPlayer.hpp"
+#include "ConsoleRenderer.hpp"
+#include "FleetGenerator.hpp"
 #include <random>
 #include <algorithm>
 
 using namespace std;
 
 namespace Battleship {
-	HumanPlayer::HumanPlayer(std::string name, int boardSize)
-		: Player(name, boardSize)
+	HumanPlayer::HumanPlayer(std::string name, const FleetConfig& fleet)
+		: Player(name, fleet)
 	{
-		shipSizes = GameBoard::MakeShipSizes(GameBoard::DEFAULT_SHIP_CONFIG);
 	}
 
 	void HumanPlayer::PlaceShips()
@@ -44,13 +45,15 @@ namespace Battleship {
 	{
 		std::cout << "\n=== РУЧНАЯ РАССТАНОВКА КОРАБЛЕЙ ===\n";
 
-		for (int size : shipSizes)
+		for (int type : m_fleet.GetShips())
 		{
+			const ShipShape& shape = m_fleet.GetShipType(type).shape;
+			int orientations = static_cast<int>(shape.GetOrientations().size());
 			bool placed = false;
 			while (!placed)
 			{
 				DisplayBoardState();
-				std::cout << "Разместите корабль размером " << size << "\n";
+				std::cout << "Разместите корабль размером " << shape.GetSize() << "\n";
 
 				int row, col, orientation;
 
@@ -60,10 +63,27 @@ namespace Battleship {
 				col = GetValidatedInput("Введите номер столбца (0-" + std::to_string(m_myBoard.GetSize() - 1) + "): ",
 					0, m_myBoard.GetSize() - 1);
 
-				// Валидация ориентации
-				orientation = GetValidatedInput("Ориентация (0 - горизонтально, 1 - вертикально): ", 0, 1);
+				// Валидация ориентации; у прямого корабля нулевой вариант горизонтальный
+				if (orientations == 1)
+				{
+					orientation = 0;
+				}
+				else if (shape.IsLine())
+				{
+					orientation = GetValidatedInput("Ориентация (0 - горизонтально, 1 - вертикально): ", 0, 1);
+				}
+				else
+				{
+					// Фигура: клетка (ряд, столбец) - левый верхний угол рамки выбранного варианта
+					for (int i = 0; i < orientations; i++)
+					{
+						std::cout << "Вариант " << i << ": " << shape.ToString(i) << "\n";
+					}
+					orientation = GetValidatedInput("Вариант формы (0-" + std::to_string(orientations - 1) + "): ",
+						0, orientations - 1);
+				}
 
-				placed = TryPlaceShip(size, row, col, orientation == 0);
+				placed = TryPlaceShip(shape, orientation, row, col);
 
 				if (!placed)
 				{
@@ -81,39 +101,28 @@ namespace Battleship {
 		std::cout << "\n=== АВТОМАТИЧЕСКАЯ РАССТАНОВКА КОРАБЛЕЙ ===\n";
 
 		std::random_device rd;
-		std::mt19937 gen(rd());
+		FleetGenerator generator(m_fleet, rd());
 
-		for (int size : shipSizes)
+		if (!generator.PlaceFleet(m_myBoard))
 		{
-			bool placed = false;
-			int attempts = 0;
-
-			while (!placed && attempts < MAX_ATTEMPTS) // Ограничение на попытки
-			{
-				int row = gen() % m_myBoard.GetSize();
-				int col = gen() % m_myBoard.GetSize();
-				bool horizontal = gen() % 2 == 0;
-
-				placed = TryPlaceShip(size, row, col, horizontal);
-				attempts++;
-			}
-
-			if (!placed)
-			{
-				std::cout << "Не удалось автоматически разместить корабль размером " << size << ". Попробуйте ручную расстановку.\n";
-				ManualPlacement();
-				return;
-			}
+			std::cout << "Не удалось автоматически разместить корабли на этом поле. Попробуйте ручную расстановку.\n";
+			ManualPlacement();
+			return;
 		}
 
 		std::cout << "Все корабли успешно расставлены автоматически!\n";
 		DisplayBoardState();
 	}
 
-	bool HumanPlayer::TryPlaceShip(int size, int row, int col, bool horizontal)
+	bool HumanPlayer::TryPlaceShip(const ShipShape& shape, int orientation, int row, int col)
 	{
-		Ship ship(size, { row, col }, horizontal);
-		return m_myBoard.PlaceShip(ship);
+		// Сначала дешёвая проверка по маске запретных клеток, корабль создаётся только при успехе
+		Ship::CoordinatesType coordinates = shape.Place(orientation, row, col);
+		if (!m_myBoard.CanPlaceShip(coordinates))
+		{
+			return false;
+		}
+		return m_myBoard.PlaceShip(Ship(coordinates));
 	}
 
 	Player::MoveType HumanPlayer::MakeMove()
@@ -130,27 +139,11 @@ namespace Battleship {
 
 	void HumanPlayer::DisplayBoardState()
 	{
-		// При расстановке показываем корабли (forOwner = true)
-		auto state = m_myBoard.GetVisibleState(true);
 		std::cout << "Ваше поле:\n";
 
-		// Вывод номеров столбцов
-		std::cout << "  ";
-		for (int j = 0; j < m_myBoard.GetSize(); j++)
-		{
-			std::cout << j << " ";
-		}
-		std::cout << "\n";
-
-		for (int i = 0; i < m_myBoard.GetSize(); i++)
-		{
-			std::cout << i << " ";
-			for (int j = 0; j < m_myBoard.GetSize(); j++)
-			{
-				std::cout << state[i][j] << " ";
-			}
-			std::cout << "\n";
-		}
+		// При расстановке показываем корабли (forOwner = true)
+		ConsoleRenderer renderer;
+		renderer.PrintBoard(m_myBoard, true);
 		std::cout << "\n";
 	}
 
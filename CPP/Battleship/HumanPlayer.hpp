@@ -9,22 +9,19 @@ namespace Battleship {
 	{
 	public:
 		// конструкторы и деконструктор
-		HumanPlayer(std::string name, int boardSize);
+		HumanPlayer(std::string name, const FleetConfig& fleet);
 		~HumanPlayer() override = default;
 
 		// публичные методы
 		void PlaceShips() override;
 		MoveType MakeMove() override;
 
-		static const int MAX_ATTEMPTS = 100;
-		GameBoard::ShipSizesType shipSizes;
-
 	private:
 		// приватные методы
 		void DisplayBoardState();
 		void ManualPlacement();
 		void AutomaticPlacement();
-		bool TryPlaceShip(int size, int row, int col, bool horizontal);
+		bool TryPlaceShip(const ShipShape& shape, int orientation, int row, int col);
 		int GetValidatedInput(const std::string& prompt, int minValue, int maxValue);
 	};
 }
\ No newline at end of file
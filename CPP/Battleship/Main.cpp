@@ -1,28 +1,210 @@
 ﻿#include "BattleshipGame.hpp"
+#include "Tournament.hpp"
+#include "GameReplay.hpp"
+#include "ConsoleRenderer.hpp"
+#include "Benchmark.hpp"
+#include <map>
+#include <memory>
+#include <string>
 
-int main() {
+// Командная строка:
+//   Battleship.exe [--placement <имя>] [--targeting <имя>]  - игра против компьютера с заданными стратегиями
+//   Battleship.exe --list                                   - список стратегий
+//   Battleship.exe --tournament <партий> <A> <B>            - турнир без интерфейса, A и B - "расстановка/стрельба"
+//   Battleship.exe --config <файл> ...                      - поле и флот из файла (формат FleetConfig::Load)
+//   Battleship.exe --tournament ... --record <файл>         - записи всех партий турнира в файл
+//   Battleship.exe --replay <файл> [<партия> [<ход>]]       - сводка по записям или поля партии после хода
+//   Battleship.exe --benchmark [shots|fleet|targeting]      - замеры поля, генерации флота и стрельбы (по умолчанию все)
+
+namespace {
+    // Сводка по файлу записей или одна партия после хода turn (-1 - до конца)
+    int Replay(const std::string& path, long long game, int turn)
+    {
+        Battleship::GameRecordReader reader(path);
+        Battleship::GameRecord record;
+
+        if (game < 0)
+        {
+            long long games = 0;
+            long long draws = 0;
+            std::map<std::string, long long> wins;
+            while (reader.Next(record))
+            {
+                games++;
+                if (record.winner < 0) draws++;
+                else wins[record.names[record.winner]]++;
+            }
+
+            std::cout << "Партий: " << games << ", ничьих: " << draws << "\n";
+            for (const auto& entry : wins)
+            {
+                std::cout << "  " << entry.first << ": " << entry.second << " побед\n";
+            }
+            return 0;
+        }
+
+        while (reader.Next(record))
+        {
+            if (record.game != game) continue;
+
+            Battleship::GameReplay replay(record);
+            replay.SeekTo(turn < 0 || turn > replay.GetTurnCount() ? replay.GetTurnCount() : turn);
+
+            std::cout << "Партия " << record.game << ": " << record.names[0] << " (зерно " << record.seeds[0] << ") против "
+                << record.names[1] << " (зерно " << record.seeds[1] << "), поле " << record.boardSize << "x" << record.boardSize << "\n";
+            for (int i = 0; i < replay.GetTurn(); i++)
+            {
+                const Battleship::GameReplay::Turn& info = replay.GetTurnInfo(i);
+                std::cout << i + 1 << ". " << record.names[info.shooter] << " (" << info.move.first << ", " << info.move.second << ") - "
+                    << (info.result == Battleship::Ship::ShotResult::eSunk ? "потоплен"
+                        : info.result == Battleship::Ship::ShotResult::eHit ? "попадание" : "промах") << "\n";
+            }
+
+            // Поля показываются целиком, с кораблями обоих игроков
+            Battleship::ConsoleRenderer renderer;
+            for (int player = 0; player < 2; player++)
+            {
+                std::cout << "\n=== ПОЛЕ " << record.names[player] << " ===\n";
+                renderer.PrintBoard(replay.GetBoard(player), true);
+            }
+
+            std::cout << "\nХод " << replay.GetTurn() << " из " << replay.GetTurnCount() << ", ";
+            if (record.winner < 0) std::cout << "ничья по лимиту выстрелов\n";
+            else std::cout << "победил " << record.names[record.winner] << "\n";
+            return 0;
+        }
+
+        std::cerr << "Партия " << game << " не найдена в " << path << std::endl;
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[]) {
 
     // Устанавливаем локаль для поддержки русского языка
     setlocale(LC_ALL, "Russian");
 
-    std::cout << "========================================\n";
-    std::cout << "           МОРСКОЙ БОЙ\n";
-    std::cout << "========================================\n";
-    std::cout << "Правила игры:\n";
-    std::cout << "- Расставьте корабли на поле 10x10\n";
-    std::cout << "- Корабли не могут касаться друг друга\n";
-    std::cout << "- Стандартный набор кораблей:\n";
-    std::cout << "  1 корабль - 4 клетки\n";
-    std::cout << "  2 корабля - 3 клетки\n";
-    std::cout << "  3 корабля - 2 клетки\n";
-    std::cout << "  4 корабля - 1 клетка\n";
-    std::cout << "- Вы можете выбрать ручную или автоматическую расстановку\n";
-    std::cout << "========================================\n\n";
+    const Battleship::StrategyRegistry& registry = Battleship::StrategyRegistry::Instance();
+    std::string placement;
+    std::string targeting;
+    Battleship::FleetConfig fleet;
+    long long tournamentGames = 0;
+    std::string tournamentFirst;
+    std::string tournamentSecond;
+    std::string recordPath;
 
     try
     {
-        const int BOARD_SIZE = 10;
-        Battleship::GameManager gameManager(BOARD_SIZE);
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--placement" && i + 1 < argc)
+            {
+                placement = registry.GetPlacement(argv[++i]).GetName();
+            }
+            else if (arg == "--targeting" && i + 1 < argc)
+            {
+                targeting = registry.GetTargeting(argv[++i]).GetName();
+            }
+            else if (arg == "--config" && i + 1 < argc)
+            {
+                std::string path = argv[++i];
+                if (!fleet.LoadFromFile(path))
+                {
+                    std::cerr << "Не удалось открыть файл: " << path << std::endl;
+                    return 1;
+                }
+            }
+            else if (arg == "--list")
+            {
+                std::cout << "Расстановка:";
+                for (const auto& name : registry.GetPlacementNames()) std::cout << " " << name;
+                std::cout << "\nСтрельба:";
+                for (const auto& name : registry.GetTargetingNames()) std::cout << " " << name;
+                std::cout << "\n";
+                return 0;
+            }
+            else if (arg == "--tournament" && i + 3 < argc)
+            {
+                tournamentGames = std::stoll(argv[i + 1]);
+                tournamentFirst = argv[i + 2];
+                tournamentSecond = argv[i + 3];
+                i += 3;
+            }
+            else if (arg == "--record" && i + 1 < argc)
+            {
+                recordPath = argv[++i];
+            }
+            else if (arg == "--benchmark")
+            {
+                std::string which = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : "all";
+                if (which != "all" && which != "shots" && which != "fleet" && which != "targeting")
+                {
+                    std::cerr << "Неизвестный замер: " << which << std::endl;
+                    return 1;
+                }
+                if (which == "all" || which == "shots") Battleship::Benchmark::RunShotBenchmark(std::cout);
+                if (which == "all" || which == "fleet") Battleship::Benchmark::RunFleetBenchmark(std::cout);
+                if (which == "all" || which == "targeting") Battleship::Benchmark::RunTargetingBenchmark(std::cout);
+                return 0;
+            }
+            else if (arg == "--replay" && i + 1 < argc)
+            {
+                std::string path = argv[++i];
+                long long game = i + 1 < argc ? std::stoll(argv[++i]) : -1;
+                int turn = i + 1 < argc ? std::stoi(argv[++i]) : -1;
+                return Replay(path, game, turn);
+            }
+            else
+            {
+                std::cerr << "Неизвестный аргумент: " << arg << std::endl;
+                return 1;
+            }
+        }
+
+        // Турнир запускается после разбора всех аргументов, чтобы учесть --config
+        if (tournamentGames > 0)
+        {
+            std::unique_ptr<Battleship::GameRecordWriter> records;
+            if (!recordPath.empty())
+            {
+                records.reset(new Battleship::GameRecordWriter(recordPath));
+            }
+
+            Battleship::Tournament::Report report = Battleship::Tournament::Run(
+                Battleship::Tournament::MakeContestant(tournamentFirst),
+                Battleship::Tournament::MakeContestant(tournamentSecond), tournamentGames, fleet, 0, 42, records.get());
+            Battleship::Tournament::PrintReports({ report }, std::cout);
+
+            if (records && !records->Close())
+            {
+                std::cerr << "Не удалось записать файл: " << recordPath << std::endl;
+                return 1;
+            }
+            return 0;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Ошибка: " << e.what() << std::endl;
+        return 1;
+    }
+
+    Battleship::GameManager::PrintRules(fleet);
+
+    try
+    {
+        // Стратегии, не заданные в командной строке, выбираются в меню
+        if (placement.empty())
+        {
+            placement = Battleship::GameManager::ChooseStrategy("Расстановка кораблей компьютера", registry.GetPlacementNames());
+        }
+        if (targeting.empty())
+        {
+            targeting = Battleship::GameManager::ChooseStrategy("Стрельба компьютера", registry.GetTargetingNames());
+        }
+
+        Battleship::GameManager gameManager(fleet, placement, targeting);
 
         // Настройка игры
         gameManager.SetupGame();
@@ -0,0 +1,73 @@
+﻿#include "MatchEngine.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace Battleship {
+	MatchEngine::MatchResult MatchEngine::Play(Player& first, Player& second, GameRecord* record)
+	{
+		std::array<Player*, 2> players = { &first, &second };
+		first.SetEnemyBoard(&second.GetMyBoard());
+		second.SetEnemyBoard(&first.GetMyBoard());
+
+		first.PlaceShips();
+		second.PlaceShips();
+
+		MatchResult result = { -1, { 0, 0 } };
+		const int size = first.GetMyBoard().GetSize();
+		const int shotLimit = SHOT_LIMIT_FACTOR * size * size;
+
+		if (record)
+		{
+			record->boardSize = size;
+			for (int i = 0; i < 2; i++)
+			{
+				record->names[i] = players[i]->GetName();
+				record->layouts[i] = players[i]->GetMyBoard().GetOccupied();
+			}
+			record->shots.clear();
+		}
+
+		int current = 0;
+		while (result.shots[current] < shotLimit)
+		{
+			Player& player = *players[current];
+			Player::MoveType move = player.MakeMove();
+
+			// Ход стратегии не доверяем: вне поля или повторный выстрел - ошибка стратегии, партия прерывается
+			const GameBoard& enemyBoard = *player.GetEnemyBoard();
+			if (!enemyBoard.IsOnBoard(move) || enemyBoard.GetShots().Test(move.first, move.second))
+			{
+				throw std::logic_error("Player " + player.GetName() + " made an invalid move: ("
+					+ std::to_string(move.first) + ", " + std::to_string(move.second) + ")"
+					+ (enemyBoard.IsOnBoard(move) ? " is already shot" : " is outside the board"));
+			}
+
+			Ship::ShotResult shot = player.GetEnemyBoard()->ReceiveShot(move);
+			player.OnShotResult(shot, move);
+			result.shots[current]++;
+			if (record)
+			{
+				record->shots.push_back(move.first * size + move.second);
+			}
+
+			if (shot == Ship::ShotResult::eHit || shot == Ship::ShotResult::eSunk)
+			{
+				if (player.GetEnemyBoard()->IsAllShipsSunk())
+				{
+					result.winner = current;
+					break;
+				}
+				continue;
+			}
+
+			// Смена хода при промахе
+			current = 1 - current;
+		}
+
+		if (record)
+		{
+			record->winner = result.winner;
+		}
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include <array>
+#include "Player.hpp"
+#include "GameRecord.hpp"
+
+namespace Battleship {
+	// Партия без интерфейса: игроки расставляют корабли и стреляют по очереди
+	// по правилам GameManager (попавший стреляет ещё раз), без вывода и пауз
+	class MatchEngine
+	{
+	public:
+		// Ограничение на число выстрелов одного игрока, в размерах поля: запасная защита от бесконечной партии (повторные ходы отсекает проверка хода)
+		static const int SHOT_LIMIT_FACTOR = 2;
+
+		// Итог партии
+		struct MatchResult
+		{
+			int winner;					// 0 - первый игрок, 1 - второй, -1 - ничья по лимиту выстрелов
+			std::array<int, 2> shots;	// выстрелы каждого игрока
+		};
+
+	public:
+		// публичные методы
+
+		// Играет партию; первым стреляет first. Игроки должны быть свежими, с пустыми полями.
+		// record, если задан, получает имена игроков, расстановки, выстрелы и итог; зёрна заполняет вызывающий.
+		// Ход вне поля или в клетку, куда уже стреляли, - std::logic_error
+		static MatchResult Play(Player& first, Player& second, GameRecord* record = nullptr);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+﻿#include "PlacementStrategies.hpp"
+#include "DensityTargeting.hpp"
+#include <functional>
+#include <limits>
+
+namespace Battleship {
+	namespace {
+		// Лучшая по оценке (меньше - лучше) из CANDIDATES случайных расстановок
+		bool PlaceBest(GameBoard& board, const FleetConfig& fleet, RandomEngine& random, int candidates,
+			const std::function<long long(int row, int col)>& cellScore)
+		{
+			FleetGenerator generator(fleet, random());
+			FleetGenerator::PlacementsType best;
+			long long bestScore = std::numeric_limits<long long>::max();
+
+			for (int i = 0; i < candidates && generator.Generate(); i++)
+			{
+				long long score = 0;
+				for (const auto& placement : generator.GetPlacements())
+				{
+					const ShipShape& shape = fleet.GetShipType(placement.type).shape;
+					for (const auto& cell : shape.GetOrientations()[placement.orientation].cells)
+					{
+						score += cellScore(placement.row + cell.first, placement.col + cell.second);
+					}
+				}
+				if (score < bestScore)
+				{
+					bestScore = score;
+					best = generator.GetPlacements();
+				}
+			}
+
+			return !best.empty() && FleetGenerator::Apply(fleet, best, board);
+		}
+	}
+
+	bool RandomPlacement::PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const
+	{
+		FleetGenerator generator(fleet, random());
+		return generator.PlaceFleet(board);
+	}
+
+	bool EdgeAvoidingPlacement::PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const
+	{
+		const int last = board.GetSize() - 1;
+		return PlaceBest(board, fleet, random, CANDIDATES, [last](int row, int col) {
+			return (row == 0 || col == 0 || row == last || col == last) ? 1LL : 0LL;
+		});
+	}
+
+	bool AdversarialPlacement::PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const
+	{
+		// Плотность на пустом поле - то, с чего начинает стрельбу DensityTargeting
+		BoardView empty(fleet);
+		DensityTargeting::DensityType density;
+		DensityTargeting::ComputeDensity(empty, false, density);
+
+		return PlaceBest(board, fleet, random, CANDIDATES, [&density](int row, int col) {
+			return static_cast<long long>(DensityTargeting::GetDensity(density, row, col));
+		});
+	}
+}
\ No newline at end of file
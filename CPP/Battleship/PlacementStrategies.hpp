@@ -0,0 +1,38 @@
+﻿#pragma once
+
+#include "Strategy.hpp"
+#include "FleetGenerator.hpp"
+
+namespace Battleship {
+	// Равновероятный выбор места для каждого корабля (FleetGenerator)
+	class RandomPlacement : public PlacementStrategy
+	{
+	public:
+		// публичные методы
+		std::string GetName() const override { return "random"; }
+		bool PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const override;
+	};
+
+	// Из нескольких случайных расстановок выбирает ту, где меньше всего клеток кораблей у края поля
+	class EdgeAvoidingPlacement : public PlacementStrategy
+	{
+	public:
+		static const int CANDIDATES = 16;
+
+		// публичные методы
+		std::string GetName() const override { return "edge-avoiding"; }
+		bool PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const override;
+	};
+
+	// Против стрельбы по плотности: из нескольких случайных расстановок выбирает ту,
+	// чьи клетки получают наименьшую плотность на пустом поле, то есть обстреливаются последними
+	class AdversarialPlacement : public PlacementStrategy
+	{
+	public:
+		static const int CANDIDATES = 16;
+
+		// публичные методы
+		std::string GetName() const override { return "adversarial"; }
+		bool PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const override;
+	};
+}
\ No newline at end of file
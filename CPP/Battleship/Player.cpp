@@ -1,9 +1,10 @@
 #include "Player.hpp"
 
 namespace Battleship {
-	Player::Player(std::string name, int boardSize)
+	Player::Player(std::string name, const FleetConfig& fleet)
 		: m_name(name)
-		, m_myBoard(boardSize)
+		, m_fleet(fleet)
+		, m_myBoard(fleet.GetBoardSize())
 		, m_enemyBoard(nullptr)
 	{
 	}
@@ -3,6 +3,7 @@
 #include <string>
 #include <utility>
 #include "GameBoard.hpp"
+#include "FleetConfig.hpp"
 
 namespace Battleship {
 	class Player
@@ -13,22 +14,27 @@ namespace Battleship {
 
 	public:
 		// конструкторы и деконструктор
-		Player(std::string name, int boardSize);
+		Player(std::string name, const FleetConfig& fleet);
 		virtual ~Player() = default;
 
 		// публичные методы
 		virtual void PlaceShips() = 0;
 		virtual MoveType MakeMove() = 0;
 
+		// Результат собственного выстрела; игроки, которые учатся на результатах, переопределяют
+		virtual void OnShotResult(Ship::ShotResult /*result*/, MoveType /*move*/) {}
+
 		// геттеры и сеттеры
 		void SetEnemyBoard(GameBoard* board) { m_enemyBoard = board; }
 		GameBoard& GetMyBoard() { return m_myBoard; }
 		GameBoard* GetEnemyBoard() { return m_enemyBoard; }
+		const FleetConfig& GetFleet() const { return m_fleet; }
 		std::string GetName() const { return m_name; }
 
 	protected:
 		// защищенные переменные
 		std::string m_name;
+		FleetConfig m_fleet;
 		GameBoard m_myBoard;
 		GameBoard* m_enemyBoard;
 	};
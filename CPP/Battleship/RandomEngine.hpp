@@ -0,0 +1,39 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace Battleship {
+	// Быстрый генератор случайных чисел (SplitMix64) для симуляций. В отличие от std::mt19937
+	// состояние - одно слово, поэтому создание генератора на каждую партию ничего не стоит.
+	// Подходит для std::shuffle и распределений <random>
+	class RandomEngine
+	{
+	public:
+		// публичные: переопределение типом
+		using result_type = std::uint32_t;
+
+	public:
+		// конструкторы и деконструктор
+		explicit RandomEngine(std::uint64_t seed = 0)
+			: m_state(seed)
+		{
+		}
+
+		// публичные методы
+		result_type operator()()
+		{
+			std::uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return static_cast<result_type>((z ^ (z >> 31)) >> 32);
+		}
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+	private:
+		// приватные переменные
+		std::uint64_t m_state;
+	};
+}
\ No newline at end of file
@@ -22,6 +22,19 @@ namespace Battleship {
 		}
 	}
 
+	Ship::Ship(const CoordinatesType& coordinates)
+		: m_size(static_cast<int>(coordinates.size()))
+		, m_coordinates(coordinates)
+		, m_hits(coordinates.size(), false)
+		, m_isHorizontal(true)
+	{
+		// Горизонтальный - если все клетки в одной строке
+		for (const auto& coord : m_coordinates)
+		{
+			m_isHorizontal = m_isHorizontal && coord.first == m_coordinates.front().first;
+		}
+	}
+
 	bool Ship::IsSunk() const
 	{
 		for (bool hit : m_hits)
@@ -23,6 +23,7 @@ namespace Battleship {
 	public:
 		// конструкторы и деконструктор
 		Ship(int size, std::pair<int, int> startCoord, bool isHorizontal);
+		Ship(const CoordinatesType& coordinates);	// корабль любой формы
 		~Ship() = default;
 
 		// публичные методы
@@ -0,0 +1,254 @@
+﻿#include "ShipShape.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+
+namespace Battleship {
+	ShipShape::ShipShape(const CellsType& cells)
+		: m_size(static_cast<int>(cells.size()))
+		, m_isLine(false)
+		, m_diagonalSpan(0)
+	{
+		CellsType base = Normalize(cells);
+		if (base.empty())
+		{
+			throw std::invalid_argument("Ship shape has no cells");
+		}
+		if (std::adjacent_find(base.begin(), base.end()) != base.end())
+		{
+			throw std::invalid_argument("Ship shape has repeated cells");
+		}
+
+		// Связность по сторонам: обход от первой клетки должен дойти до всех
+		std::vector<bool> visited(base.size(), false);
+		std::vector<size_t> stack = { 0 };
+		visited[0] = true;
+		size_t reached = 1;
+		while (!stack.empty())
+		{
+			CellType cell = base[stack.back()];
+			stack.pop_back();
+			for (size_t i = 0; i < base.size(); i++)
+			{
+				if (!visited[i] && std::abs(base[i].first - cell.first) + std::abs(base[i].second - cell.second) == 1)
+				{
+					visited[i] = true;
+					stack.push_back(i);
+					reached++;
+				}
+			}
+		}
+		if (reached != base.size())
+		{
+			throw std::invalid_argument("Ship shape is not connected");
+		}
+
+		// Четыре поворота формы и её отражения; совпадающие варианты не повторяются
+		std::vector<CellsType> variants;
+		CellsType current = base;
+		for (int mirror = 0; mirror < 2; mirror++)
+		{
+			for (int turn = 0; turn < 4; turn++)
+			{
+				current = Normalize(current);
+				if (std::find(variants.begin(), variants.end(), current) == variants.end())
+				{
+					variants.push_back(current);
+				}
+				for (auto& cell : current)
+				{
+					cell = { cell.second, -cell.first };
+				}
+			}
+			for (auto& cell : current)
+			{
+				cell.second = -cell.second;
+			}
+		}
+
+		for (const auto& variant : variants)
+		{
+			m_orientations.push_back(MakeOrientation(variant));
+		}
+
+		// Низкие варианты первыми: у прямого корабля нулевой вариант горизонтальный
+		std::stable_sort(m_orientations.begin(), m_orientations.end(),
+			[](const Orientation& a, const Orientation& b) { return a.height < b.height; });
+
+		const Orientation& first = m_orientations.front();
+		if (first.width > BitBoard::MAX_SIZE || first.height > BitBoard::MAX_SIZE)
+		{
+			throw std::out_of_range("Ship shape is larger than the maximum board");
+		}
+		m_isLine = first.height == 1;
+
+		// Клетки связны по сторонам, поэтому накрытые диагонали идут подряд
+		m_diagonalSpan = m_size;
+		for (const auto& orientation : m_orientations)
+		{
+			int low = orientation.height + orientation.width;
+			int high = 0;
+			for (const auto& cell : orientation.cells)
+			{
+				low = std::min(low, cell.first + cell.second);
+				high = std::max(high, cell.first + cell.second);
+			}
+			m_diagonalSpan = std::min(m_diagonalSpan, high - low + 1);
+		}
+	}
+
+	ShipShape ShipShape::MakeLine(int length)
+	{
+		CellsType cells;
+		for (int i = 0; i < length; i++)
+		{
+			cells.push_back({ 0, i });
+		}
+		return ShipShape(cells);
+	}
+
+	ShipShape ShipShape::Parse(const std::string& pattern)
+	{
+		CellsType cells;
+		int row = 0;
+		int col = 0;
+		for (char symbol : pattern)
+		{
+			switch (symbol)
+			{
+			case '/':
+				row++;
+				col = 0;
+				break;
+			case '#':
+				cells.push_back({ row, col++ });
+				break;
+			case '.':
+				col++;
+				break;
+			default:
+				throw std::invalid_argument(std::string("Unexpected symbol in ship shape: ") + symbol);
+			}
+		}
+		return ShipShape(cells);
+	}
+
+	ShipShape::CellsType ShipShape::Place(int orientation, int row, int col) const
+	{
+		CellsType cells = m_orientations[orientation].cells;
+		for (auto& cell : cells)
+		{
+			cell.first += row;
+			cell.second += col;
+		}
+		return cells;
+	}
+
+	bool ShipShape::Matches(const CellsType& cells) const
+	{
+		if (static_cast<int>(cells.size()) != m_size)
+		{
+			return false;
+		}
+
+		CellsType normalized = Normalize(cells);
+		for (const auto& orientation : m_orientations)
+		{
+			if (orientation.cells == normalized)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::string ShipShape::ToString(int orientation) const
+	{
+		const Orientation& variant = m_orientations[orientation];
+		std::string pattern;
+		for (int i = 0; i < variant.height; i++)
+		{
+			if (i > 0)
+			{
+				pattern += '/';
+			}
+			for (int j = 0; j < variant.width; j++)
+			{
+				pattern += ((variant.rows[i] >> j) & 1) ? '#' : '.';
+			}
+		}
+		return pattern;
+	}
+
+	ShipShape::CellsType ShipShape::Normalize(CellsType cells)
+	{
+		if (cells.empty())
+		{
+			return cells;
+		}
+
+		int top = cells.front().first;
+		int left = cells.front().second;
+		for (const auto& cell : cells)
+		{
+			top = std::min(top, cell.first);
+			left = std::min(left, cell.second);
+		}
+		for (auto& cell : cells)
+		{
+			cell.first -= top;
+			cell.second -= left;
+		}
+		std::sort(cells.begin(), cells.end());
+		return cells;
+	}
+
+	ShipShape::Orientation ShipShape::MakeOrientation(const CellsType& cells)
+	{
+		Orientation orientation;
+		orientation.cells = cells;
+		orientation.height = 0;
+		orientation.width = 0;
+		for (const auto& cell : cells)
+		{
+			orientation.height = std::max(orientation.height, cell.first + 1);
+			orientation.width = std::max(orientation.width, cell.second + 1);
+		}
+
+		// Столбцы за пределами самого большого поля не нужны: такие формы отсеиваются по ширине
+		orientation.rows.assign(orientation.height, 0);
+		orientation.haloRows.assign(orientation.height + 2, 0);
+		orientation.haloLeft.assign(orientation.height + 2, false);
+		for (const auto& cell : cells)
+		{
+			if (cell.second < BitBoard::MAX_SIZE)
+			{
+				orientation.rows[cell.first] |= BitBoard::RowType(1) << cell.second;
+			}
+		}
+
+		for (const auto& cell : cells)
+		{
+			for (int dr = -1; dr <= 1; dr++)
+			{
+				for (int dc = -1; dc <= 1; dc++)
+				{
+					CellType neighbour = { cell.first + dr, cell.second + dc };
+					if (std::binary_search(cells.begin(), cells.end(), neighbour))
+					{
+						continue;
+					}
+					if (neighbour.second < 0)
+					{
+						orientation.haloLeft[neighbour.first + 1] = true;
+					}
+					else if (neighbour.second < BitBoard::MAX_SIZE)
+					{
+						orientation.haloRows[neighbour.first + 1] |= BitBoard::RowType(1) << neighbour.second;
+					}
+				}
+			}
+		}
+		return orientation;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include <vector>
+#include <utility>
+#include <string>
+#include "BitBoard.hpp"
+
+namespace Battleship {
+	// Форма корабля: связные по сторонам клетки. Хранит все различные повороты
+	// и отражения формы, приведённые к левому верхнему углу, вместе с их строками-масками
+	// и соседними клетками, чтобы генератор и стратегии перебирали места без пересчёта
+	class ShipShape
+	{
+	public:
+		// публичные: переопределение типом
+		using CellType = std::pair<int, int>;
+		using CellsType = std::vector<CellType>;
+
+		// Один вариант формы; клетки отсчитываются от левого верхнего угла рамки
+		struct Orientation
+		{
+			CellsType cells;							// клетки по возрастанию (строка, столбец)
+			std::vector<BitBoard::RowType> rows;		// клетки строка за строкой, бит - столбец
+			std::vector<BitBoard::RowType> haloRows;	// соседние клетки, в том числе по диагонали, по строкам -1..height
+			std::vector<bool> haloLeft;				// есть ли соседняя клетка в столбце -1, по строкам -1..height
+			int height;
+			int width;
+		};
+
+		using OrientationsType = std::vector<Orientation>;
+
+		// Четыре поворота и их отражения
+		static const int MAX_ORIENTATIONS = 8;
+
+	public:
+		// конструкторы и деконструктор
+
+		// Бросает std::invalid_argument, если клеток нет, они повторяются или не связны
+		ShipShape(const CellsType& cells);
+		~ShipShape() = default;
+
+		// публичные методы
+
+		// Прямой корабль из length клеток; горизонтальный вариант первый
+		static ShipShape MakeLine(int length);
+
+		// Форма из рисунка: строки через '/', '#' - клетка корабля, '.' - пусто, например "#./##"
+		static ShipShape Parse(const std::string& pattern);
+
+		// Клетки варианта orientation с левым верхним углом рамки в (row, col)
+		CellsType Place(int orientation, int row, int col) const;
+
+		// Совпадают ли клетки с одним из вариантов формы (с точностью до сдвига)
+		bool Matches(const CellsType& cells) const;
+
+		// Рисунок варианта orientation в формате Parse
+		std::string ToString(int orientation = 0) const;
+
+		// геттеры
+		int GetSize() const { return m_size; }
+		bool IsLine() const { return m_isLine; }
+		const OrientationsType& GetOrientations() const { return m_orientations; }
+
+		// Сколько соседних диагоналей (row + col) накрывает любое место корабля
+		int GetDiagonalSpan() const { return m_diagonalSpan; }
+
+	private:
+		// приватные методы
+		static CellsType Normalize(CellsType cells);
+		static Orientation MakeOrientation(const CellsType& cells);
+
+		// приватные переменные
+		int m_size;
+		bool m_isLine;
+		int m_diagonalSpan;
+		OrientationsType m_orientations;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+﻿#pragma once
+
+#include <string>
+#include <utility>
+#include "GameBoard.hpp"
+#include "FleetConfig.hpp"
+#include "BoardView.hpp"
+#include "RandomEngine.hpp"
+
+namespace Battleship {
+	// Стратегия выбора выстрела. Не хранит состояния: всё знание о партии - в BoardView,
+	// случайность - в генераторе игрока, поэтому один объект обслуживает любые потоки
+	class TargetingStrategy
+	{
+	public:
+		// публичные: переопределение типом
+		using MoveType = BoardView::MoveType;
+
+	public:
+		// конструкторы и деконструктор
+		virtual ~TargetingStrategy() = default;
+
+		// публичные методы
+		virtual std::string GetName() const = 0;
+		virtual MoveType SelectShot(const BoardView& view, RandomEngine& random) const = 0;
+	};
+
+	// Стратегия расстановки флота на пустом поле; так же без состояния
+	class PlacementStrategy
+	{
+	public:
+		// конструкторы и деконструктор
+		virtual ~PlacementStrategy() = default;
+
+		// публичные методы
+		virtual std::string GetName() const = 0;
+		virtual bool PlaceFleet(GameBoard& board, const FleetConfig& fleet, RandomEngine& random) const = 0;
+	};
+}
\ No newline at end of file
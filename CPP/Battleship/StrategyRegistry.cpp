@@ -0,0 +1,93 @@
+﻿#include "StrategyRegistry.hpp"
+#include "TargetingStrategies.hpp"
+#include "DensityTargeting.hpp"
+#include "PlacementStrategies.hpp"
+#include <stdexcept>
+
+namespace Battleship {
+	StrategyRegistry::StrategyRegistry()
+	{
+		Register(std::make_unique<RandomTargeting>());
+		Register(std::make_unique<ParityTargeting>());
+		Register(std::make_unique<DensityTargeting>());
+
+		Register(std::make_unique<RandomPlacement>());
+		Register(std::make_unique<EdgeAvoidingPlacement>());
+		Register(std::make_unique<AdversarialPlacement>());
+	}
+
+	StrategyRegistry& StrategyRegistry::Instance()
+	{
+		static StrategyRegistry instance;
+		return instance;
+	}
+
+	void StrategyRegistry::Register(std::unique_ptr<TargetingStrategy> strategy)
+	{
+		m_targeting.push_back(std::move(strategy));
+	}
+
+	void StrategyRegistry::Register(std::unique_ptr<PlacementStrategy> strategy)
+	{
+		m_placement.push_back(std::move(strategy));
+	}
+
+	const TargetingStrategy* StrategyRegistry::FindTargeting(const std::string& name) const
+	{
+		// Позже зарегистрированная стратегия перекрывает одноимённую встроенную
+		for (auto it = m_targeting.rbegin(); it != m_targeting.rend(); ++it)
+		{
+			if ((*it)->GetName() == name) return it->get();
+		}
+		return nullptr;
+	}
+
+	const PlacementStrategy* StrategyRegistry::FindPlacement(const std::string& name) const
+	{
+		for (auto it = m_placement.rbegin(); it != m_placement.rend(); ++it)
+		{
+			if ((*it)->GetName() == name) return it->get();
+		}
+		return nullptr;
+	}
+
+	const TargetingStrategy& StrategyRegistry::GetTargeting(const std::string& name) const
+	{
+		const TargetingStrategy* strategy = FindTargeting(name);
+		if (!strategy)
+		{
+			throw std::invalid_argument("Unknown targeting strategy: " + name);
+		}
+		return *strategy;
+	}
+
+	const PlacementStrategy& StrategyRegistry::GetPlacement(const std::string& name) const
+	{
+		const PlacementStrategy* strategy = FindPlacement(name);
+		if (!strategy)
+		{
+			throw std::invalid_argument("Unknown placement strategy: " + name);
+		}
+		return *strategy;
+	}
+
+	StrategyRegistry::NamesType StrategyRegistry::GetTargetingNames() const
+	{
+		NamesType names;
+		for (const auto& strategy : m_targeting)
+		{
+			names.push_back(strategy->GetName());
+		}
+		return names;
+	}
+
+	StrategyRegistry::NamesType StrategyRegistry::GetPlacementNames() const
+	{
+		NamesType names;
+		for (const auto& strategy : m_placement)
+		{
+			names.push_back(strategy->GetName());
+		}
+		return names;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "Strategy.hpp"
+
+namespace Battleship {
+	// Реестр именованных стратегий расстановки и стрельбы. Встроенные стратегии
+	// регистрируются при первом обращении; свои можно добавить через Register до начала игр.
+	// Объекты стратегий не имеют состояния, поэтому их можно использовать из любых потоков
+	class StrategyRegistry
+	{
+	public:
+		// публичные: переопределение типом
+		using NamesType = std::vector<std::string>;
+
+	public:
+		// публичные методы
+		static StrategyRegistry& Instance();
+
+		void Register(std::unique_ptr<TargetingStrategy> strategy);
+		void Register(std::unique_ptr<PlacementStrategy> strategy);
+
+		// nullptr, если стратегии с таким именем нет
+		const TargetingStrategy* FindTargeting(const std::string& name) const;
+		const PlacementStrategy* FindPlacement(const std::string& name) const;
+
+		// Бросают std::invalid_argument, если стратегии с таким именем нет
+		const TargetingStrategy& GetTargeting(const std::string& name) const;
+		const PlacementStrategy& GetPlacement(const std::string& name) const;
+
+		NamesType GetTargetingNames() const;
+		NamesType GetPlacementNames() const;
+
+	private:
+		// конструкторы и деконструктор
+		StrategyRegistry();
+		StrategyRegistry(const StrategyRegistry&) = delete;
+		StrategyRegistry& operator=(const StrategyRegistry&) = delete;
+
+		// приватные переменные
+		std::vector<std::unique_ptr<TargetingStrategy>> m_targeting;
+		std::vector<std::unique_ptr<PlacementStrategy>> m_placement;
+	};
+}
\ No newline at end of file
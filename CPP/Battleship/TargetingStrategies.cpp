@@ -0,0 +1,106 @@
+﻿#include "TargetingStrategies.hpp"
+#include <cstdint>
+
+namespace Battleship {
+	TargetingStrategy::MoveType RandomTargeting::SelectShot(const BoardView& view, RandomEngine& random) const
+	{
+		MoveType move = { 0, 0 };
+		if (view.HasTargets() && ParityTargeting::SelectRandom(ParityTargeting::GetTargetCells(view), random, move))
+		{
+			return move;
+		}
+
+		ParityTargeting::SelectRandom(view.GetOpenCells(), random, move);
+		return move;
+	}
+
+	TargetingStrategy::MoveType ParityTargeting::SelectShot(const BoardView& view, RandomEngine& random) const
+	{
+		MoveType move = { 0, 0 };
+		if (view.HasTargets() && SelectRandom(GetTargetCells(view), random, move))
+		{
+			return move;
+		}
+
+		BitBoard open = view.GetOpenCells();
+		int step = view.GetParityStep();
+		if (step > 1)
+		{
+			// Оставляем клетки диагоналей (row + col) % step == 0
+			BitBoard parity(view.GetSize());
+			for (int i = 0; i < view.GetSize(); i++)
+			{
+				BitBoard::RowType bits = 0;
+				for (int col = (step - i % step) % step; col < view.GetSize(); col += step)
+				{
+					bits |= BitBoard::RowType(1) << col;
+				}
+				parity.SetRow(i, bits);
+			}
+			parity &= open;
+			if (!parity.IsEmpty())
+			{
+				open = parity;
+			}
+		}
+
+		SelectRandom(open, random, move);
+		return move;
+	}
+
+	BitBoard ParityTargeting::GetTargetCells(const BoardView& view)
+	{
+		const int size = view.GetSize();
+		const BitBoard& hits = view.GetHits();
+		const BitBoard::RowType rowMask = BitBoard::MakeRowMask(size);
+
+		// Попадания, у которых есть соседнее попадание по горизонтали или вертикали, задают направление.
+		// У фигурного корабля следующая клетка может быть в стороне от линии, поэтому там направления нет.
+		// Направление своё у каждой группы попаданий: одиночное попадание идёт во все четыре стороны,
+		// даже если у другого корабля уже есть линия
+		const bool isLinear = view.GetFleet().IsLinear();
+		BitBoard horizontal(size);
+		BitBoard vertical(size);
+		for (int i = 0; i < size; i++)
+		{
+			BitBoard::RowType row = hits.GetRow(i);
+			BitBoard::RowType alongRow = 0;
+			BitBoard::RowType alongColumn = 0;
+			if (isLinear)
+			{
+				BitBoard::RowType neighbours = (i > 0 ? hits.GetRow(i - 1) : 0) | (i + 1 < size ? hits.GetRow(i + 1) : 0);
+				alongRow = row & ((row << 1) | (row >> 1));
+				alongColumn = row & neighbours;
+			}
+			BitBoard::RowType single = row & ~alongRow & ~alongColumn;
+			horizontal.SetRow(i, alongRow | single);
+			vertical.SetRow(i, alongColumn | single);
+		}
+
+		// Продолжаем линии и одиночные попадания
+		BitBoard cells(size);
+		for (int i = 0; i < size; i++)
+		{
+			BitBoard::RowType row = horizontal.GetRow(i);
+			BitBoard::RowType bits = (row << 1) | (row >> 1);
+			if (i > 0) bits |= vertical.GetRow(i - 1);
+			if (i + 1 < size) bits |= vertical.GetRow(i + 1);
+			cells.SetRow(i, bits & rowMask);
+		}
+
+		cells &= view.GetOpenCells();
+		return cells;
+	}
+
+	bool ParityTargeting::SelectRandom(const BitBoard& cells, RandomEngine& random, MoveType& move)
+	{
+		int count = cells.Count();
+		if (count == 0)
+		{
+			return false;
+		}
+
+		int rank = static_cast<int>((static_cast<std::uint64_t>(random()) * count) >> 32);
+		return cells.Select(rank, move.first, move.second);
+	}
+}
\ No newline at end of file
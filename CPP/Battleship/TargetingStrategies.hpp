@@ -0,0 +1,34 @@
+﻿#pragma once
+
+#include "Strategy.hpp"
+
+namespace Battleship {
+	// Случайный выстрел в клетку, где корабль ещё возможен; после попадания -
+	// случайный сосед попадания, а при линии из двух попаданий - продолжение линии
+	// (только если все корабли флота прямые)
+	class RandomTargeting : public TargetingStrategy
+	{
+	public:
+		// публичные методы
+		std::string GetName() const override { return "random"; }
+		MoveType SelectShot(const BoardView& view, RandomEngine& random) const override;
+	};
+
+	// Поиск по шахматной раскраске с шагом наименьшего корабля на плаву:
+	// корабль, накрывающий k диагоналей подряд, обязательно накрывает клетку,
+	// где (row + col) % k == 0; у прямого корабля k - его длина.
+	// Добивание - как у RandomTargeting
+	class ParityTargeting : public TargetingStrategy
+	{
+	public:
+		// публичные методы
+		std::string GetName() const override { return "parity"; }
+		MoveType SelectShot(const BoardView& view, RandomEngine& random) const override;
+
+		// Клетки для добивания попаданий; пусто, если попаданий нет
+		static BitBoard GetTargetCells(const BoardView& view);
+
+		// Случайная клетка маски; false, если маска пуста
+		static bool SelectRandom(const BitBoard& cells, RandomEngine& random, MoveType& move);
+	};
+}
\ No newline at end of file
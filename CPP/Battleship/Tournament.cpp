@@ -0,0 +1,194 @@
+﻿#include "Tournament.hpp"
+#include "MatchEngine.hpp"
+#include "StrategyRegistry.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace Battleship {
+	Tournament::Contestant Tournament::MakeContestant(const std::string& name)
+	{
+		const StrategyRegistry& registry = StrategyRegistry::Instance();
+		size_t slash = name.find('/');
+		if (slash == std::string::npos)
+		{
+			return { &registry.GetPlacement("random"), &registry.GetTargeting(name) };
+		}
+		return { &registry.GetPlacement(name.substr(0, slash)), &registry.GetTargeting(name.substr(slash + 1)) };
+	}
+
+	Tournament::Report Tournament::Run(const Contestant& first, const Contestant& second, long long games,
+		const FleetConfig& fleet, unsigned threads, std::uint32_t seed, GameRecordWriter* records)
+	{
+		if (threads == 0)
+		{
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		// Партии раздаются порциями, чтобы потоки реже трогали общий счётчик
+		const long long CHUNK = 256;
+		std::atomic<long long> next(0);
+		std::vector<Report> partial(threads);
+
+		// Исключение из потока не должно его покидать: первое сохраняется и бросается после join
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		auto play = [&](unsigned index) {
+			Report& local = partial[index];
+			local.games = 0;
+			local.firstWins = 0;
+			local.secondWins = 0;
+
+			// Записи копятся в пакете потока и уходят на диск фоновым потоком писателя
+			GameRecord record;
+			const std::array<std::string, 2> names = { first.GetName(), second.GetName() };
+			std::optional<GameRecordWriter::Batch> batch;
+			if (records)
+			{
+				batch.emplace(*records);
+			}
+
+			for (;;)
+			{
+				long long begin = next.fetch_add(CHUNK, std::memory_order_relaxed);
+				if (begin >= games) break;
+				long long end = std::min(begin + CHUNK, games);
+
+				for (long long game = begin; game < end; game++)
+				{
+					// Зерно зависит только от номера партии: результат не зависит от числа потоков
+					std::uint32_t gameSeed = seed + static_cast<std::uint32_t>(game) * 2;
+					AIPlayer firstPlayer("A", fleet, *first.placement, *first.targeting, gameSeed);
+					AIPlayer secondPlayer("B", fleet, *second.placement, *second.targeting, gameSeed + 1);
+
+					// В чётных партиях первым стреляет first, в нечётных - second
+					bool swapped = game % 2 == 1;
+					GameRecord* gameRecord = batch ? &record : nullptr;
+					MatchEngine::MatchResult result = swapped
+						? MatchEngine::Play(secondPlayer, firstPlayer, gameRecord)
+						: MatchEngine::Play(firstPlayer, secondPlayer, gameRecord);
+
+					if (batch)
+					{
+						record.game = game;
+						// В записи игроки идут в порядке хода
+						record.names[0] = names[swapped ? 1 : 0];
+						record.names[1] = names[swapped ? 0 : 1];
+						record.seeds[0] = swapped ? gameSeed + 1 : gameSeed;
+						record.seeds[1] = swapped ? gameSeed : gameSeed + 1;
+						batch->Add(record);
+					}
+
+					local.games++;
+					if (result.winner < 0) continue;
+
+					int shots = result.shots[result.winner];
+					bool firstWon = (result.winner == 0) != swapped;
+					local.shotsToWin.Add(shots);
+					if (firstWon)
+					{
+						local.firstWins++;
+						local.firstShotsToWin.Add(shots);
+					}
+					else
+					{
+						local.secondWins++;
+						local.secondShotsToWin.Add(shots);
+					}
+				}
+			}
+		};
+
+		auto worker = [&](unsigned index) {
+			try
+			{
+				play(index);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+				// Остальные потоки доигрывают свою порцию и останавливаются
+				next.store(games, std::memory_order_relaxed);
+			}
+		};
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::thread> pool;
+		pool.reserve(threads);
+		for (unsigned i = 0; i < threads; i++)
+		{
+			pool.emplace_back(worker, i);
+		}
+		for (auto& thread : pool)
+		{
+			thread.join();
+		}
+		auto finish = std::chrono::steady_clock::now();
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+
+		Report report;
+		report.firstName = first.GetName();
+		report.secondName = second.GetName();
+		report.games = 0;
+		report.firstWins = 0;
+		report.secondWins = 0;
+		for (const auto& local : partial)
+		{
+			report.games += local.games;
+			report.firstWins += local.firstWins;
+			report.secondWins += local.secondWins;
+			report.shotsToWin.Merge(local.shotsToWin);
+			report.firstShotsToWin.Merge(local.firstShotsToWin);
+			report.secondShotsToWin.Merge(local.secondShotsToWin);
+		}
+		report.seconds = std::chrono::duration<double>(finish - start).count();
+		return report;
+	}
+
+	std::vector<Tournament::Report> Tournament::RunAll(long long gamesPerPair, std::ostream& out)
+	{
+		StrategyRegistry::NamesType names = StrategyRegistry::Instance().GetTargetingNames();
+
+		std::vector<Report> reports;
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			for (size_t j = i; j < names.size(); j++)
+			{
+				reports.push_back(Run(MakeContestant(names[i]), MakeContestant(names[j]), gamesPerPair));
+			}
+		}
+
+		PrintReports(reports, out);
+		return reports;
+	}
+
+	void Tournament::PrintReports(const std::vector<Report>& reports, std::ostream& out)
+	{
+		out << "=== Battleship Tournament ===\n";
+		for (const auto& report : reports)
+		{
+			out << std::left << std::setw(20) << report.firstName << " vs " << std::setw(20) << report.secondName << std::right
+				<< " games: " << std::setw(10) << report.games
+				<< "  win rate: " << std::fixed << std::setprecision(2) << std::setw(6) << report.GetFirstWinRate() * 100 << "%"
+				<< " / " << std::setw(6) << report.GetSecondWinRate() * 100 << "%"
+				<< "  shots to win: " << std::setprecision(2) << report.firstShotsToWin.GetMean()
+				<< " / " << report.secondShotsToWin.GetMean()
+				<< "  games/sec: " << std::setprecision(0) << report.GetGamesPerSecond() << "\n";
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include "AIPlayer.hpp"
+#include "Strategy.hpp"
+#include "GameRecordWriter.hpp"
+#include "../StreamingStatistics.hpp"
+
+namespace Battleship {
+	// Турнир ИИ против ИИ: много партий без интерфейса на пуле потоков
+	class Tournament
+	{
+	public:
+		// Участник: стратегии расстановки и стрельбы
+		struct Contestant
+		{
+			const PlacementStrategy* placement;
+			const TargetingStrategy* targeting;
+
+			std::string GetName() const { return placement->GetName() + "/" + targeting->GetName(); }
+		};
+
+		// Сводка по паре соперников
+		struct Report
+		{
+			std::string firstName;
+			std::string secondName;
+			long long games;
+			long long firstWins;
+			long long secondWins;
+			GameLauncher::StreamingStatistics<int> shotsToWin;			// выстрелы победителя, все партии
+			GameLauncher::StreamingStatistics<int> firstShotsToWin;		// выстрелы первого в его победах
+			GameLauncher::StreamingStatistics<int> secondShotsToWin;	// выстрелы второго в его победах
+			double seconds;
+
+			long long GetDraws() const { return games - firstWins - secondWins; }
+			double GetFirstWinRate() const { return games > 0 ? static_cast<double>(firstWins) / games : 0.0; }
+			double GetSecondWinRate() const { return games > 0 ? static_cast<double>(secondWins) / games : 0.0; }
+			double GetGamesPerSecond() const { return seconds > 0.0 ? games / seconds : 0.0; }
+		};
+
+	public:
+		// публичные методы
+
+		// Участник по имени "расстановка/стрельба" или просто "стрельба" (расстановка random).
+		// Бросает std::invalid_argument, если стратегии нет в реестре
+		static Contestant MakeContestant(const std::string& name);
+
+		// Играет games партий first против second с полем и флотом fleet.
+		// Право первого выстрела чередуется; threads = 0 - по числу ядер.
+		// records, если задан, получает запись каждой партии (порядок партий в файле не гарантирован).
+		// Исключение из партии в любом потоке бросается отсюда, когда все потоки остановлены
+		static Report Run(const Contestant& first, const Contestant& second, long long games,
+			const FleetConfig& fleet = FleetConfig(), unsigned threads = 0, std::uint32_t seed = 42,
+			GameRecordWriter* records = nullptr);
+
+		// Прогоняет все пары стратегий стрельбы из реестра (расстановка random) и печатает отчёт
+		static std::vector<Report> RunAll(long long gamesPerPair, std::ostream& out = std::cout);
+
+		// Печатает отчёты в виде таблицы
+		static void PrintReports(const std::vector<Report>& reports, std::ostream& out);
+	};
+}
\ No newline at end of file
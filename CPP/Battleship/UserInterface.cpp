@@ -10,63 +10,29 @@ namespace Battleship {
 
 	void UserInterface::DisplayBoards(Player* player)
 	{
-		std::cout << "========================================\n";
-		std::cout << "         ТЕКУЩЕЕ СОСТОЯНИЕ\n";
-		std::cout << "========================================\n";
-		std::cout << "Игрок: " << player->GetName() << "\n\n";
-
-		// Поле игрока - показываем корабли (forOwner = true)
-		std::cout << "=== ВАШЕ ПОЛЕ ===\n";
-		auto myState = player->GetMyBoard().GetVisibleState(true);
-
-		// Вывод номеров столбцов
-		std::cout << "  ";
-		for (int j = 0; j < player->GetMyBoard().GetSize(); j++)
-		{
-			std::cout << j << " ";
-		}
-		std::cout << "\n";
-
-		for (int i = 0; i < player->GetMyBoard().GetSize(); i++)
-		{
-			std::cout << i << " ";
-			for (int j = 0; j < player->GetMyBoard().GetSize(); j++)
-			{
-				std::cout << myState[i][j] << " ";
-			}
-			std::cout << "\n";
-		}
-
-		// Поле противника - НЕ показываем корабли (forOwner = false)
-		std::cout << "\n=== ПОЛЕ ПРОТИВНИКА ===\n";
-		auto enemyState = player->GetEnemyBoard()->GetVisibleState(false);
-
-		// Вывод номеров столбцов
-		std::cout << "  ";
-		for (int j = 0; j < player->GetEnemyBoard()->GetSize(); j++)
-		{
-			std::cout << j << " ";
-		}
-		std::cout << "\n";
-
-		for (int i = 0; i < player->GetEnemyBoard()->GetSize(); i++)
-		{
-			std::cout << i << " ";
-			for (int j = 0; j < player->GetEnemyBoard()->GetSize(); j++)
-			{
-				std::cout << enemyState[i][j] << " ";
-			}
-			std::cout << "\n";
-		}
+		// Кадр собирается целиком и выводится одной записью; неизменные строки не перерисовываются
+		m_renderer.BeginFrame();
+		m_renderer.AddText("========================================");
+		m_renderer.AddText("         ТЕКУЩЕЕ СОСТОЯНИЕ");
+		m_renderer.AddText("========================================");
+		m_renderer.AddText("Игрок: " + player->GetName());
+		m_renderer.AddText("");
+
+		// Своё поле - с кораблями (forOwner = true), поле противника - только выстрелы
+		m_renderer.AddBoards("=== ВАШЕ ПОЛЕ ===", player->GetMyBoard(), true,
+			"=== ПОЛЕ ПРОТИВНИКА ===", *player->GetEnemyBoard(), false);
 
 		// Легенда
-		DisplayLegend();
-		std::cout << "========================================\n";
+		m_renderer.AddText("");
+		m_renderer.AddText(m_renderer.FormatCell('S') + " - ваш корабль   " + m_renderer.FormatCell('X') + " - попадание   " +
+			m_renderer.FormatCell('O') + " - промах   " + m_renderer.FormatCell('.') + " - неизвестная клетка");
+		m_renderer.AddText("========================================");
+		m_renderer.Present();
 	}
 
 	void UserInterface::DisplayMessage(const std::string& message)
 	{
-		std::cout << message << "\n";
+		m_renderer.AddEvent(message);
 	}
 
 	void UserInterface::ShowGameOver(const std::string& winnerName)
@@ -85,25 +51,7 @@ namespace Battleship {
 				std::cout << "\n=== РАСКРЫТОЕ ПОЛЕ ПРОТИВНИКА ===\n";
 
 				// Используем forOwner = true чтобы показать все корабли противника
-				auto revealedState = currentPlayer->GetEnemyBoard()->GetVisibleState(true);
-
-				// Вывод номеров столбцов
-				std::cout << "  ";
-				for (int j = 0; j < currentPlayer->GetEnemyBoard()->GetSize(); j++)
-				{
-					std::cout << j << " ";
-				}
-				std::cout << "\n";
-
-				for (int i = 0; i < currentPlayer->GetEnemyBoard()->GetSize(); i++)
-				{
-					std::cout << i << " ";
-					for (int j = 0; j < currentPlayer->GetEnemyBoard()->GetSize(); j++)
-					{
-						std::cout << revealedState[i][j] << " ";
-					}
-					std::cout << "\n";
-				}
+				m_renderer.PrintBoard(*currentPlayer->GetEnemyBoard(), true);
 			}
 		}
 		std::cout << "========================================\n";
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Player.hpp"
+#include "ConsoleRenderer.hpp"
 #include <string>
 
 namespace Battleship {
@@ -23,5 +24,6 @@ namespace Battleship {
 	private:
 		// приватные переменные
 		GameManager* m_gameManager;
+		ConsoleRenderer m_renderer;
 	};
 }
@@ -164,6 +164,16 @@ namespace Blackjack {
 
     void BlackjackGame::quitGame() {
         gameRunning = false;
+
+        const auto& rounds = gameState->getRoundStatistics();
+        if (!rounds.IsEmpty()) {
+            std::cout << "\nRounds played: " << rounds.GetCount()
+                << ", net result: " << rounds.GetSum()
+                << ", average per round: " << rounds.GetMean()
+                << " (+/- " << rounds.GetStandardDeviation() << ")"
+                << ", best: " << rounds.GetMax()
+                << ", worst: " << rounds.GetMin() << "\n";
+        }
         std::cout << "\nThanks for playing!\n";
     }
 
@@ -83,23 +83,31 @@ namespace Blackjack {
 
     void GameState::winBet() {
         playerBalance += currentBet * 2;
+        roundResults.Add(currentBet);
         currentBet = 0;
     }
 
     void GameState::loseBet() {
+        roundResults.Add(-currentBet);
         currentBet = 0;
     }
 
     void GameState::pushBet() {
         playerBalance += currentBet;
+        roundResults.Add(0);
         currentBet = 0;
     }
 
     void GameState::blackjackWin() {
         playerBalance += static_cast<int>(currentBet * 2.5); //  3:2
+        roundResults.Add(static_cast<int>(currentBet * 1.5));
         currentBet = 0;
     }
 
+    const GameLauncher::StreamingStatistics<int>& GameState::getRoundStatistics() const {
+        return roundResults;
+    }
+
     bool GameState::isGameOver() const {
         return currentStatus == GameStatus::GAME_OVER;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Enums.hpp"
+#include "../StreamingStatistics.hpp"
 
 namespace Blackjack {
 
@@ -12,6 +13,7 @@ namespace Blackjack {
         bool isPlayerTurn;
         int playerBalance;
         int currentBet;
+        GameLauncher::StreamingStatistics<int> roundResults; // Net win or loss of each round
 
     public:
         GameState(int initialBalance = 1000);
@@ -43,5 +45,8 @@ namespace Blackjack {
         bool isBettingPhase() const;
         bool isPlayerTurnPhase() const;
         bool isDealerTurnPhase() const;
+
+        // Statistics
+        const GameLauncher::StreamingStatistics<int>& getRoundStatistics() const;
     };
 }
\ No newline at end of file
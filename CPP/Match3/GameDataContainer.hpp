@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <string>
 #include <iostream>
+#include "../StreamingStatistics.hpp"
 
 namespace Match3 {
 
@@ -219,22 +220,19 @@ namespace Match3 {
         Statistics CalculateStatistics() const {
             Statistics stats{ 0.0, 0, 0, 0 };
 
-            if (dataItems.empty()) {
-                return stats;
-            }
-
-            stats.min = dataItems[0]->GetValue();
-            stats.max = dataItems[0]->GetValue();
-
+            GameLauncher::StreamingStatistics<int> accumulator;
             for (const auto& item : dataItems) {
-                int value = item->GetValue();
-                stats.total += value;
+                accumulator.Add(item->GetValue());
+            }
 
-                if (value < stats.min) stats.min = value;
-                if (value > stats.max) stats.max = value;
+            if (accumulator.IsEmpty()) {
+                return stats;
             }
 
-            stats.average = static_cast<double>(stats.total) / dataItems.size();
+            stats.average = accumulator.GetMean();
+            stats.min = accumulator.GetMin();
+            stats.max = accumulator.GetMax();
+            stats.total = static_cast<int>(accumulator.GetSum());
             return stats;
         }
 
@@ -5,48 +5,44 @@
 #include <algorithm>
 #include <type_traits>
 #include <functional>
+#include "../StreamingStatistics.hpp"
 
 namespace GameLauncher {
 
     /// <summary>
-    /// ????????? ??????? ??? ?????????? ?????????? ?? ????????? ????????
-    /// ???????????: T ?????? ???????????? ???????? < ? ???? ?????????????? ?????
+    /// Итоговая статистика по набору значений
     /// </summary>
     template<typename T>
-    typename std::enable_if<std::is_arithmetic<T>::value, struct Statistics>::type
-        CalculateStatistics(const std::vector<T>& data) {
-        struct Statistics {
-            T min;
-            T max;
-            double average;
-            T median;
-            T sum;
-        };
+    struct Statistics {
+        T min;
+        T max;
+        double average;
+        double median;
+        typename StreamingStatistics<T>::SumType sum;
+    };
 
-        if (data.empty()) {
-            return Statistics{ T(), T(), 0.0, T(), T() };
+    /// <summary>
+    /// Статистика за один проход потоковым накопителем; медиана - через nth_element,
+    /// без сортировки копии данных
+    /// </summary>
+    template<typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value, Statistics<T>>::type
+        CalculateStatistics(const std::vector<T>& data) {
+        StreamingStatistics<T> accumulator(StreamingStatistics<T>::QuantileMode::Exact);
+        for (const auto& value : data) {
+            accumulator.Add(value);
         }
 
-        // ??????? ????? ??? ??????????
-        std::vector<T> sorted = data;
-        std::sort(sorted.begin(), sorted.end());
-
-        // ????????? ??????????
-        Statistics stats;
-        stats.min = sorted.front();
-        stats.max = sorted.back();
-        stats.sum = std::accumulate(sorted.begin(), sorted.end(), T(0));
-        stats.average = static_cast<double>(stats.sum) / sorted.size();
-
-        // ????????? ???????
-        size_t size = sorted.size();
-        if (size % 2 == 0) {
-            stats.median = (sorted[size / 2 - 1] + sorted[size / 2]) / 2;
-        }
-        else {
-            stats.median = sorted[size / 2];
+        if (accumulator.IsEmpty()) {
+            return Statistics<T>{ T(), T(), 0.0, 0.0, 0 };
         }
 
+        Statistics<T> stats;
+        stats.min = accumulator.GetMin();
+        stats.max = accumulator.GetMax();
+        stats.sum = accumulator.GetSum();
+        stats.average = accumulator.GetMean();
+        stats.median = accumulator.GetMedian();
         return stats;
     }
 
@@ -0,0 +1,173 @@
+﻿#include "AutoPlayer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+
+namespace MineSweeper {
+
+    AutoPlayer::AutoPlayer(MineField& field)
+        : field(field),
+        solver(field.GetRows(), field.GetCols(), field.GetMinesCount()),
+        safeLeft(field.GetCellsCount() - field.GetMinesCount()),
+        moves(0)
+    {
+    }
+
+    AutoPlayer::GameResult AutoPlayer::Play()
+    {
+        GameResult result = { false, 0, 0 };
+
+        while (safeLeft > 0)
+        {
+            // Полный Solve на каждом шаге: ранний перебор находит мины, пока компоненты
+            // границы малы, и это заметно повышает процент побед против FindSafeCells
+            solver.Solve();
+
+            // Копия: Open дополняет решатель и может изменить список
+            std::vector<int> safe(solver.GetSafeCells());
+            if (!safe.empty())
+            {
+                for (int cell : safe)
+                {
+                    Open(cell / field.GetCols(), cell % field.GetCols());
+                }
+                continue;
+            }
+
+            MineSolver::Hint hint;
+            if (!solver.GetHint(hint))
+                break;
+
+            // Первый ход в отложенных режимах безопасен по построению поля - это не угадывание
+            bool safeFirstMove = moves == 0 && field.GetGenerationMode() != MineField::GenerationMode::Immediate;
+            if (!hint.isCertain && !safeFirstMove)
+            {
+                result.guesses++;
+            }
+            if (!Open(hint.row, hint.col))
+            {
+                result.moves = moves;
+                return result;
+            }
+        }
+
+        result.won = safeLeft == 0;
+        result.moves = moves;
+        return result;
+    }
+
+    bool AutoPlayer::Open(int row, int col)
+    {
+        // Клетка могла открыться каскадом от соседней
+        if (field.IsOpened(row, col))
+            return true;
+
+        moves++;
+        if (!field.OpenCell(row, col))
+        {
+            return !field.IsMine(row, col);
+        }
+
+        const std::vector<int>& opened = field.GetLastOpenedCells();
+        safeLeft -= static_cast<int>(opened.size());
+        solver.Apply(field, opened);
+        return true;
+    }
+
+    BatchRunner::Report BatchRunner::Run(const DifficultyManager::DifficultySettings& settings, long long games,
+        MineField::GenerationMode mode, unsigned threads, MineField::SeedType seed)
+    {
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        // Партии раздаются порциями, чтобы потоки реже трогали общий счётчик
+        const long long CHUNK = 256;
+        std::atomic<long long> next(0);
+        std::vector<long long> wins(threads, 0);
+        std::vector<GameLauncher::StreamingStatistics<int>> guesses(threads);
+
+        auto worker = [&](unsigned index) {
+            MineField field(FieldSize{ settings.rows, settings.cols }, settings.minesCount,
+                static_cast<MineField::SeedType>(seed + index), mode);
+
+            // Ядра уже заняты партиями: поиск поля без угадывания идёт в потоке партии
+            field.SetGenerationThreads(1);
+
+            long long localWins = 0;
+            GameLauncher::StreamingStatistics<int> localGuesses;
+            for (;;)
+            {
+                long long first = next.fetch_add(CHUNK, std::memory_order_relaxed);
+                if (first >= games) break;
+                long long last = std::min(first + CHUNK, games);
+
+                for (long long game = first; game < last; game++)
+                {
+                    field.Initialize();
+                    AutoPlayer player(field);
+                    AutoPlayer::GameResult result = player.Play();
+                    localWins += result.won ? 1 : 0;
+                    localGuesses.Add(result.guesses);
+                }
+            }
+            wins[index] = localWins;
+            guesses[index] = localGuesses;
+        };
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+        for (unsigned i = 0; i < threads; i++)
+        {
+            pool.emplace_back(worker, i);
+        }
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+        auto finish = std::chrono::steady_clock::now();
+
+        Report report;
+        report.difficulty = settings.name;
+        report.games = games;
+        report.wins = 0;
+        for (unsigned i = 0; i < threads; i++)
+        {
+            report.wins += wins[i];
+            report.guesses.Merge(guesses[i]);
+        }
+        report.seconds = std::chrono::duration<double>(finish - start).count();
+        return report;
+    }
+
+    std::vector<BatchRunner::Report> BatchRunner::RunAll(const DifficultyManager& manager, long long gamesPerDifficulty,
+        std::ostream& out, MineField::GenerationMode mode)
+    {
+        std::vector<Report> reports;
+        for (int i = 0; i < manager.GetDifficultyCount(); i++)
+        {
+            reports.push_back(Run(manager.GetSettings(i), gamesPerDifficulty, mode));
+        }
+
+        PrintReports(reports, out);
+        return reports;
+    }
+
+    void BatchRunner::PrintReports(const std::vector<Report>& reports, std::ostream& out)
+    {
+        out << "=== MineSweeper AutoPlayer ===\n";
+        for (const auto& report : reports)
+        {
+            out << std::left << std::setw(12) << report.difficulty << std::right
+                << " games: " << std::setw(10) << report.games
+                << "  win rate: " << std::fixed << std::setprecision(2) << std::setw(6) << report.GetWinRate() * 100 << "%"
+                << "  guesses/game: " << std::setprecision(3) << report.guesses.GetMean()
+                << " (max " << report.guesses.GetMax() << ")"
+                << "  games/sec: " << std::setprecision(0) << report.GetGamesPerSecond() << "\n";
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include "MineField.hpp"
+#include "MineSolver.hpp"
+#include "DifficultyManager.hpp"
+#include "../StreamingStatistics.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Автоигрок без интерфейса: открывает всё, что MineSolver считает безопасным,
+    /// а когда таких клеток нет - клетку с наименьшей вероятностью мины
+    /// (точный перебор границы с учётом общего числа мин)
+    /// </summary>
+    class AutoPlayer
+    {
+    public:
+        /// <summary>
+        /// Итог одной партии
+        /// </summary>
+        struct GameResult
+        {
+            bool won;
+            int moves;      // Число вызовов OpenCell
+            int guesses;    // Ходы без гарантии безопасности (кроме первого хода в отложенных режимах)
+        };
+
+    public:
+        /// <summary>
+        /// Конструктор автоигрока для поля (поле должно быть только что инициализировано)
+        /// </summary>
+        explicit AutoPlayer(MineField& field);
+
+        /// <summary>
+        /// Играет партию до победы или подрыва
+        /// </summary>
+        GameResult Play();
+
+    private:
+        MineField& field;
+        MineSolver solver;
+        int safeLeft;
+        int moves;
+
+        /// <summary>
+        /// Открывает клетку; возвращает false при подрыве
+        /// </summary>
+        bool Open(int row, int col);
+    };
+
+    /// <summary>
+    /// Пакетный прогон автоигрока по уровням сложности на всех ядрах -
+    /// постоянный замер пропускной способности MineField и MineSolver
+    /// </summary>
+    class BatchRunner
+    {
+    public:
+        /// <summary>
+        /// Сводка по одному уровню сложности
+        /// </summary>
+        struct Report
+        {
+            std::string difficulty;
+            long long games;
+            long long wins;
+            GameLauncher::StreamingStatistics<int> guesses; // Угадывания за партию
+            double seconds;
+
+            double GetWinRate() const { return games > 0 ? static_cast<double>(wins) / games : 0.0; }
+            double GetGamesPerSecond() const { return seconds > 0.0 ? games / seconds : 0.0; }
+        };
+
+        /// <summary>
+        /// Играет games партий с заданными настройками; threads = 0 - по числу ядер
+        /// </summary>
+        static Report Run(const DifficultyManager::DifficultySettings& settings, long long games,
+            MineField::GenerationMode mode = MineField::GenerationMode::FirstClickSafe,
+            unsigned threads = 0, MineField::SeedType seed = 42);
+
+        /// <summary>
+        /// Прогоняет все уровни сложности менеджера и печатает отчёт
+        /// </summary>
+        static std::vector<Report> RunAll(const DifficultyManager& manager, long long gamesPerDifficulty,
+            std::ostream& out = std::cout,
+            MineField::GenerationMode mode = MineField::GenerationMode::FirstClickSafe);
+
+        /// <summary>
+        /// Печатает отчёты в виде таблицы
+        /// </summary>
+        static void PrintReports(const std::vector<Report>& reports, std::ostream& out);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+﻿#include "Benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace MineSweeper {
+
+    Benchmark::Result Benchmark::MeasurePlacement(int size, double density, int iterations, MineField::SeedType seed)
+    {
+        int mines = static_cast<int>(size * size * density);
+        MineField field(size, mines, seed);
+
+        // Плоскости поля выделены один раз; между итерациями мины стираются вне замера,
+        // так что время - только расстановка, без перевыделения Initialize
+        double totalMilliseconds = 0.0;
+        for (int i = 0; i < iterations; i++)
+        {
+            for (auto& row : field.mines)
+            {
+                std::fill(row.begin(), row.end(), false);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            field.PlaceMines();
+            auto finish = std::chrono::steady_clock::now();
+            totalMilliseconds += std::chrono::duration<double, std::milli>(finish - start).count();
+        }
+
+        std::ostringstream name;
+        name << "PlaceMines " << size << "x" << size << " @ " << static_cast<int>(density * 100) << "%";
+
+        Result result;
+        result.name = name.str();
+        result.iterations = iterations;
+        result.totalMilliseconds = totalMilliseconds;
+        return result;
+    }
+
+    std::vector<Benchmark::Result> Benchmark::RunPlacementBenchmark(std::ostream& out)
+    {
+        const int FIELD_SIZE = 1000;
+        const int ITERATIONS = 20;
+
+        std::vector<Result> results;
+        for (double density : { 0.10, 0.50, 0.95 })
+        {
+            results.push_back(MeasurePlacement(FIELD_SIZE, density, ITERATIONS));
+        }
+
+        PrintResults(results, out);
+        return results;
+    }
+
+    void Benchmark::PrintResults(const std::vector<Result>& results, std::ostream& out)
+    {
+        out << "=== MineSweeper Benchmark ===\n";
+        for (const auto& result : results)
+        {
+            out << std::left << std::setw(36) << result.name
+                << std::right << std::setw(10) << std::fixed << std::setprecision(3)
+                << result.GetMillisecondsPerIteration() << " ms/iter"
+                << " (" << result.iterations << " iterations)\n";
+        }
+    }
+}
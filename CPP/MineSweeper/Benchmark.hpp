@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include "MineField.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Замеры производительности игрового движка "Сапёра" (без интерфейса)
+    /// </summary>
+    class Benchmark
+    {
+    public:
+        /// <summary>
+        /// Результат одного замера
+        /// </summary>
+        struct Result
+        {
+            std::string name;
+            int iterations;
+            double totalMilliseconds;
+
+            double GetMillisecondsPerIteration() const
+            {
+                return iterations > 0 ? totalMilliseconds / iterations : 0.0;
+            }
+        };
+
+        /// <summary>
+        /// Замеряет расстановку мин на поле size x size с заданной плотностью
+        /// </summary>
+        static Result MeasurePlacement(int size, double density, int iterations, MineField::SeedType seed = 42);
+
+        /// <summary>
+        /// Прогоняет расстановку при плотности 10%, 50% и 95% и печатает отчёт
+        /// </summary>
+        static std::vector<Result> RunPlacementBenchmark(std::ostream& out = std::cout);
+
+        /// <summary>
+        /// Печатает результаты в виде таблицы
+        /// </summary>
+        static void PrintResults(const std::vector<Result>& results, std::ostream& out);
+    };
+}
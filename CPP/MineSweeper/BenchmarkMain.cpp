@@ -0,0 +1,85 @@
+﻿#include "Benchmark.hpp"
+#include "AutoPlayer.hpp"
+#include "DifficultyManager.hpp"
+#include <clocale>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Консольные замеры "Сапёра" - отдельная программа, как Battleship.exe и Blackjack.exe;
+// собирается из этого файла и исходников движка MineSweeper без WinForms:
+//   MineSweeperBenchmark.exe [--placement]    - расстановка мин на поле 1000x1000
+//   MineSweeperBenchmark.exe --autoplay [N]   - N партий автоигрока на каждом уровне (по умолчанию 10000);
+//                                               уровни берутся из MineSweeperPresets.txt, как в игре
+//   MineSweeperBenchmark.exe --no-guess       - автоигрок на полях без угадывания
+int main(int argc, char* argv[]) {
+
+    // Устанавливаем локаль для поддержки русского языка
+    setlocale(LC_ALL, "Russian");
+
+    bool placement = argc == 1;
+    long long autoplayGames = 0;
+    auto mode = MineSweeper::MineField::GenerationMode::FirstClickSafe;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--placement")
+        {
+            placement = true;
+        }
+        else if (arg == "--autoplay")
+        {
+            autoplayGames = 10000;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                autoplayGames = std::atoll(argv[++i]);
+                if (autoplayGames <= 0)
+                {
+                    std::cerr << "Число партий должно быть положительным" << std::endl;
+                    return 1;
+                }
+            }
+        }
+        else if (arg == "--no-guess")
+        {
+            mode = MineSweeper::MineField::GenerationMode::NoGuess;
+            if (autoplayGames == 0) autoplayGames = 10000;
+        }
+        else
+        {
+            std::cerr << "Неизвестный аргумент: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    try
+    {
+        if (placement)
+        {
+            MineSweeper::Benchmark::RunPlacementBenchmark(std::cout);
+        }
+
+        if (autoplayGames > 0)
+        {
+            // Ошибка в файле уровней не мешает прогону на встроенных
+            MineSweeper::DifficultyManager manager;
+            try
+            {
+                manager.LoadPresetsFromFile(MineSweeper::DifficultyManager::DEFAULT_PRESETS_FILE);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Файл уровней не загружен: " << e.what() << std::endl;
+            }
+
+            MineSweeper::BatchRunner::RunAll(manager, autoplayGames, std::cout, mode);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Ошибка: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,336 @@
+﻿#include "BoardGenerator.hpp"
+#include "MineSolver.hpp"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+
+namespace MineSweeper {
+
+    std::vector<int> BoardGenerator::SampleMineCells(int cellsCount, int mines,
+        std::vector<int> excluded, std::mt19937& random)
+    {
+        // Исключённые клетки убираем из выборки: k-я свободная клетка
+        // получается сдвигом k на число исключённых клеток не правее неё
+        std::sort(excluded.begin(), excluded.end());
+        excluded.erase(std::unique(excluded.begin(), excluded.end()), excluded.end());
+
+        const int available = cellsCount - static_cast<int>(excluded.size());
+        auto toCell = [&excluded](int rank) {
+            for (int cell : excluded) {
+                if (cell <= rank) rank++;
+            }
+            return rank;
+        };
+
+        std::vector<int> result;
+        result.reserve(mines);
+
+        // На i-м шаге выбираем случайный элемент из [i, available) и меняем его с i-м
+        if (mines >= available / DENSE_PLACEMENT_RATIO)
+        {
+            // Плотное поле: явный массив индексов, O(available) = O(mines)
+            std::vector<int> ranks(available);
+            std::iota(ranks.begin(), ranks.end(), 0);
+
+            for (int i = 0; i < mines; i++)
+            {
+                std::uniform_int_distribution<int> dist(i, available - 1);
+                std::swap(ranks[i], ranks[dist(random)]);
+                result.push_back(toCell(ranks[i]));
+            }
+            return result;
+        }
+
+        // Разреженное поле: храним только переставленные элементы,
+        // время и память - O(mines) независимо от размера поля
+        std::unordered_map<int, int> moved;
+        moved.reserve(static_cast<size_t>(mines) * 2);
+
+        auto valueAt = [&moved](int index) {
+            auto it = moved.find(index);
+            return it != moved.end() ? it->second : index;
+        };
+
+        for (int i = 0; i < mines; i++)
+        {
+            std::uniform_int_distribution<int> dist(i, available - 1);
+            int j = dist(random);
+            int rank = valueAt(j);
+            moved[j] = valueAt(i);
+            result.push_back(toCell(rank));
+        }
+        return result;
+    }
+
+    std::vector<int> BoardGenerator::GetSafeZone(int rows, int cols, int mines, int row, int col)
+    {
+        std::vector<int> zone;
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                int r = row + dr;
+                int c = col + dc;
+                if (r >= 0 && r < rows && c >= 0 && c < cols)
+                {
+                    zone.push_back(r * cols + c);
+                }
+            }
+        }
+
+        // Конструктор поля гарантирует лишь одну свободную клетку
+        if (mines > rows * cols - static_cast<int>(zone.size()))
+        {
+            zone.assign(1, row * cols + col);
+        }
+        return zone;
+    }
+
+    BoardGenerator::Layout BoardGenerator::GenerateFirstClickSafe(int rows, int cols, int mines, int row, int col, std::mt19937& random)
+    {
+        Layout layout(static_cast<size_t>(rows) * cols, 0);
+        for (int cell : SampleMineCells(rows * cols, mines, GetSafeZone(rows, cols, mines, row, col), random))
+        {
+            layout[cell] = 1;
+        }
+        return layout;
+    }
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        /// <summary>
+        /// Общая часть синхронной и фоновой генерации: кандидаты перебираются в threadsCount потоках,
+        /// пока не найдено поле, не исчерпаны попытки или время либо не выставлен cancel.
+        /// Пустой результат - подходящее поле не найдено
+        /// </summary>
+        BoardGenerator::Layout SearchNoGuess(int rows, int cols, int mines, int row, int col,
+            std::mt19937& random, int maxAttempts, Clock::time_point deadline,
+            std::atomic<int>& attempts, const std::atomic<bool>& cancel, unsigned threadsCount)
+        {
+            const std::vector<int> safeZone = BoardGenerator::GetSafeZone(rows, cols, mines, row, col);
+            if (threadsCount == 0)
+            {
+                threadsCount = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            std::atomic<bool> found(false);
+            std::mutex resultMutex;
+            BoardGenerator::Layout result;
+
+            // Каждый поток получает своё зерно из генератора поля,
+            // поэтому при заданном зерне набор кандидатов воспроизводим
+            std::vector<std::mt19937::result_type> seeds(threadsCount);
+            for (auto& seed : seeds)
+            {
+                seed = random();
+            }
+
+            auto worker = [&](std::mt19937::result_type seed) {
+                std::mt19937 local(seed);
+                BoardGenerator::Layout layout(static_cast<size_t>(rows) * cols, 0);
+                std::vector<int> cells;
+
+                while (!found.load(std::memory_order_relaxed) &&
+                    !cancel.load(std::memory_order_relaxed) &&
+                    Clock::now() < deadline &&
+                    attempts.fetch_add(1, std::memory_order_relaxed) < maxAttempts)
+                {
+                    // Сбрасываем только мины прошлого кандидата
+                    for (int cell : cells) layout[cell] = 0;
+                    cells = BoardGenerator::SampleMineCells(rows * cols, mines, safeZone, local);
+                    for (int cell : cells) layout[cell] = 1;
+
+                    if (BoardGenerator::IsSolvableWithoutGuessing(layout, rows, cols, row, col))
+                    {
+                        std::lock_guard<std::mutex> lock(resultMutex);
+                        if (!found.exchange(true))
+                        {
+                            result = layout;
+                        }
+                    }
+                }
+            };
+
+            // Один поток - без запуска нового: вызывающий, скорее всего, сам один из многих
+            if (threadsCount == 1)
+            {
+                worker(seeds[0]);
+                return result;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadsCount);
+            for (unsigned i = 0; i < threadsCount; i++)
+            {
+                threads.emplace_back(worker, seeds[i]);
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            return result;
+        }
+    }
+
+    BoardGenerator::Layout BoardGenerator::GenerateNoGuess(int rows, int cols, int mines, int row, int col,
+        std::mt19937& random, int maxAttempts, unsigned threads)
+    {
+        if (rows * cols > MAX_NO_GUESS_CELLS)
+        {
+            return GenerateFirstClickSafe(rows, cols, mines, row, col, random);
+        }
+
+        std::atomic<int> attempts(0);
+        std::atomic<bool> cancel(false);
+        Layout result = SearchNoGuess(rows, cols, mines, row, col, random, maxAttempts,
+            Clock::now() + std::chrono::milliseconds(MAX_NO_GUESS_MILLISECONDS), attempts, cancel, threads);
+
+        if (result.empty())
+        {
+            return GenerateFirstClickSafe(rows, cols, mines, row, col, random);
+        }
+        return result;
+    }
+
+    struct NoGuessGeneration::State
+    {
+        std::atomic<bool> cancel{ false };
+        std::atomic<bool> ready{ false };
+        std::atomic<int> attempts{ 0 };
+        Clock::time_point started;
+        BoardGenerator::Layout layout;
+        std::thread thread;
+    };
+
+    NoGuessGeneration::NoGuessGeneration(int rows, int cols, int mines, int row, int col, std::mt19937::result_type seed)
+        : state(std::make_unique<State>()), row(row), col(col)
+    {
+        state->started = Clock::now();
+
+        State* shared = state.get();
+        state->thread = std::thread([shared, rows, cols, mines, row, col, seed]() {
+            std::mt19937 random(seed);
+            if (rows * cols <= BoardGenerator::MAX_NO_GUESS_CELLS)
+            {
+                shared->layout = SearchNoGuess(rows, cols, mines, row, col, random,
+                    BoardGenerator::DEFAULT_MAX_ATTEMPTS,
+                    shared->started + std::chrono::milliseconds(BoardGenerator::MAX_NO_GUESS_MILLISECONDS),
+                    shared->attempts, shared->cancel, 0);
+            }
+            if (shared->layout.empty())
+            {
+                shared->layout = BoardGenerator::GenerateFirstClickSafe(rows, cols, mines, row, col, random);
+            }
+            shared->ready.store(true, std::memory_order_release);
+        });
+    }
+
+    NoGuessGeneration::~NoGuessGeneration()
+    {
+        state->cancel = true;
+        if (state->thread.joinable())
+        {
+            state->thread.join();
+        }
+    }
+
+    bool NoGuessGeneration::IsReady() const
+    {
+        return state->ready.load(std::memory_order_acquire);
+    }
+
+    double NoGuessGeneration::GetProgress() const
+    {
+        if (IsReady()) return 1.0;
+
+        const double byAttempts = static_cast<double>(state->attempts.load(std::memory_order_relaxed)) /
+            BoardGenerator::DEFAULT_MAX_ATTEMPTS;
+        const double byTime = std::chrono::duration<double, std::milli>(Clock::now() - state->started).count() /
+            BoardGenerator::MAX_NO_GUESS_MILLISECONDS;
+        return std::min(1.0, std::max(byAttempts, byTime));
+    }
+
+    BoardGenerator::Layout NoGuessGeneration::TakeLayout()
+    {
+        if (state->thread.joinable())
+        {
+            state->thread.join();
+        }
+        return std::move(state->layout);
+    }
+
+    bool BoardGenerator::IsSolvableWithoutGuessing(const Layout& layout, int rows, int cols, int row, int col)
+    {
+        const int cellsCount = rows * cols;
+        if (layout[row * cols + col]) return false;
+
+        // Числа в клетках
+        std::vector<char> numbers(cellsCount, 0);
+        int mines = 0;
+        for (int cell = 0; cell < cellsCount; cell++)
+        {
+            if (!layout[cell]) continue;
+            mines++;
+            int r = cell / cols, c = cell % cols;
+            for (int dr = -1; dr <= 1; dr++)
+                for (int dc = -1; dc <= 1; dc++)
+                {
+                    int nr = r + dr, nc = c + dc;
+                    if (nr >= 0 && nr < rows && nc >= 0 && nc < cols)
+                        numbers[nr * cols + nc]++;
+                }
+        }
+
+        MineSolver solver(rows, cols, mines);
+        std::vector<char> opened(cellsCount, 0);
+        std::vector<int> flood;
+        int safeLeft = cellsCount - mines;
+
+        // Открытие с каскадом по нулям, как в MineField::OpenCell
+        auto open = [&](int start) {
+            if (opened[start]) return;
+            opened[start] = 1;
+            flood.push_back(start);
+            while (!flood.empty())
+            {
+                int cell = flood.back();
+                flood.pop_back();
+                safeLeft--;
+
+                int r = cell / cols, c = cell % cols;
+                solver.Reveal(r, c, numbers[cell]);
+                if (numbers[cell] != 0) continue;
+
+                for (int dr = -1; dr <= 1; dr++)
+                    for (int dc = -1; dc <= 1; dc++)
+                    {
+                        int nr = r + dr, nc = c + dc;
+                        if (nr >= 0 && nr < rows && nc >= 0 && nc < cols && !opened[nr * cols + nc])
+                        {
+                            opened[nr * cols + nc] = 1;
+                            flood.push_back(nr * cols + nc);
+                        }
+                    }
+            }
+        };
+
+        // Открываем только то, что решатель считает гарантированно безопасным
+        open(row * cols + col);
+        while (safeLeft > 0)
+        {
+            const std::vector<int>& safe = solver.FindSafeCells();
+            if (safe.empty()) break;
+
+            std::vector<int> batch(safe);
+            for (int cell : batch) open(cell);
+        }
+
+        return safeLeft == 0;
+    }
+}
\ No newline at end of file
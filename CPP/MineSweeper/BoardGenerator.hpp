@@ -0,0 +1,107 @@
+﻿#pragma once
+
+#include <vector>
+#include <random>
+#include <memory>
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Генератор расстановок мин: случайная расстановка, безопасная для первого хода,
+    /// и расстановка "без угадывания", которую можно пройти одной логикой.
+    /// Работает с плоскими индексами клеток (row * cols + col) и не зависит от MineField
+    /// </summary>
+    class BoardGenerator
+    {
+    public:
+        // Флаг мины по индексу клетки
+        using Layout = std::vector<char>;
+
+        // Лимит кандидатов при поиске поля без угадывания (суммарно по всем потокам)
+        static constexpr int DEFAULT_MAX_ATTEMPTS = 20000;
+
+        // На полях крупнее поле без угадывания почти не встречается - сразу обычная генерация
+        static constexpr int MAX_NO_GUESS_CELLS = 4096;
+
+        // Предел времени поиска поля без угадывания, мс: после него - обычное безопасное поле
+        static constexpr int MAX_NO_GUESS_MILLISECONDS = 3000;
+
+        /// <summary>
+        /// Выбирает mines различных клеток из cellsCount, пропуская excluded.
+        /// Частичная перетасовка Фишера-Йейтса: ровно mines шагов без повторных попыток
+        /// </summary>
+        static std::vector<int> SampleMineCells(int cellsCount, int mines,
+            std::vector<int> excluded, std::mt19937& random);
+
+        /// <summary>
+        /// Клетки, свободные от мин при первом ходе в (row, col): окрестность 3x3.
+        /// Если мин слишком много для такой зоны, остаётся только сама клетка
+        /// </summary>
+        static std::vector<int> GetSafeZone(int rows, int cols, int mines, int row, int col);
+
+        /// <summary>
+        /// Расстановка с безопасной окрестностью первого хода
+        /// </summary>
+        static Layout GenerateFirstClickSafe(int rows, int cols, int mines, int row, int col, std::mt19937& random);
+
+        /// <summary>
+        /// Расстановка, которую решатель проходит от первого хода без угадывания.
+        /// Кандидаты генерируются параллельно в threads потоках (0 - по числу ядер,
+        /// 1 - в вызывающем потоке, для тех, кто сам параллелит партии); если за maxAttempts
+        /// или MAX_NO_GUESS_MILLISECONDS подходящее поле не найдено
+        /// (или поле больше MAX_NO_GUESS_CELLS), возвращается обычное безопасное поле.
+        /// Вызов блокирующий - из интерфейса используйте NoGuessGeneration
+        /// </summary>
+        static Layout GenerateNoGuess(int rows, int cols, int mines, int row, int col,
+            std::mt19937& random, int maxAttempts = DEFAULT_MAX_ATTEMPTS, unsigned threads = 0);
+
+        /// <summary>
+        /// Проверяет, открывает ли MineSolver всё поле, начиная с клетки (row, col)
+        /// </summary>
+        static bool IsSolvableWithoutGuessing(const Layout& layout, int rows, int cols, int row, int col);
+
+    private:
+        // Начиная с плотности 1/8 перетасовка идёт по явному массиву индексов
+        static constexpr int DENSE_PLACEMENT_RATIO = 8;
+    };
+
+    /// <summary>
+    /// Фоновый поиск поля без угадывания для первого хода в (row, col).
+    /// Поток запускается конструктором; вызывающий опрашивает IsReady и GetProgress,
+    /// не блокируя интерфейс. Деструктор отменяет незавершённый поиск
+    /// </summary>
+    class NoGuessGeneration
+    {
+    public:
+        NoGuessGeneration(int rows, int cols, int mines, int row, int col, std::mt19937::result_type seed);
+        ~NoGuessGeneration();
+
+        NoGuessGeneration(const NoGuessGeneration&) = delete;
+        NoGuessGeneration& operator=(const NoGuessGeneration&) = delete;
+
+        int GetRow() const { return row; }
+        int GetCol() const { return col; }
+
+        /// <summary>
+        /// Завершён ли поиск (найдено поле или исчерпан лимит попыток либо времени)
+        /// </summary>
+        bool IsReady() const;
+
+        /// <summary>
+        /// Израсходованная доля лимита попыток или времени, от 0 до 1
+        /// </summary>
+        double GetProgress() const;
+
+        /// <summary>
+        /// Забирает расстановку; если поиск ещё идёт, дожидается его
+        /// </summary>
+        BoardGenerator::Layout TakeLayout();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> state;  // Поток и его счётчики живут в BoardGenerator.cpp
+        int row;
+        int col;
+    };
+}
\ No newline at end of file
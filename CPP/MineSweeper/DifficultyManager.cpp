@@ -1,4 +1,7 @@
 ﻿#include "DifficultyManager.hpp"
+#include "MineField.hpp"
+#include <fstream>
+#include <sstream>
 #include <stdexcept>
 
 namespace MineSweeper {
@@ -6,9 +9,10 @@ namespace MineSweeper {
     DifficultyManager::DifficultyManager() : currentDifficulty(0)
     {
         difficulties = {
-            { "Легкий", 10, 10, 600 },
-            { "Средний", 12, 20, 480 },
-            { "Сложный", 15, 40, 360 }
+            { "Легкий", 10, 10, 10, 600 },
+            { "Средний", 12, 12, 20, 480 },
+            { "Сложный", 15, 15, 40, 360 },
+            { "Эксперт", 16, 30, 99, 999 }
         };
     }
 
@@ -25,6 +29,14 @@ namespace MineSweeper {
         return difficulties[currentDifficulty];
     }
 
+    const DifficultyManager::DifficultySettings& DifficultyManager::GetSettings(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(difficulties.size())) {
+            throw std::out_of_range("Invalid difficulty index");
+        }
+        return difficulties[index];
+    }
+
     std::vector<std::string> DifficultyManager::GetDifficultyNames() const
     {
         std::vector<std::string> names;
@@ -36,4 +48,91 @@ namespace MineSweeper {
 
         return names;
     }
+
+    int DifficultyManager::AddDifficulty(const DifficultySettings& settings)
+    {
+        ValidateSettings(settings);
+
+        for (size_t i = 0; i < difficulties.size(); i++) {
+            if (difficulties[i].name == settings.name) {
+                difficulties[i] = settings;
+                return static_cast<int>(i);
+            }
+        }
+
+        difficulties.push_back(settings);
+        return static_cast<int>(difficulties.size()) - 1;
+    }
+
+    int DifficultyManager::LoadPresets(std::istream& in)
+    {
+        std::vector<DifficultySettings> loaded;
+        std::string line;
+        int lineNumber = 0;
+
+        while (std::getline(in, line)) {
+            lineNumber++;
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            std::istringstream fields(line);
+            DifficultySettings settings;
+            std::string rows, cols, mines, timeLimit;
+            if (!std::getline(fields, settings.name, ';') ||
+                !std::getline(fields, rows, ';') ||
+                !std::getline(fields, cols, ';') ||
+                !std::getline(fields, mines, ';') ||
+                !std::getline(fields, timeLimit)) {
+                throw std::invalid_argument("Malformed preset at line " + std::to_string(lineNumber));
+            }
+
+            try {
+                settings.rows = std::stoi(rows);
+                settings.cols = std::stoi(cols);
+                settings.minesCount = std::stoi(mines);
+                settings.timeLimit = std::stoi(timeLimit);
+                ValidateSettings(settings);
+            }
+            catch (const std::exception& ex) {
+                throw std::invalid_argument("Invalid preset at line " + std::to_string(lineNumber) + ": " + ex.what());
+            }
+            loaded.push_back(settings);
+        }
+
+        // Уровни добавляются только если весь файл корректен
+        for (const auto& settings : loaded) {
+            AddDifficulty(settings);
+        }
+        return static_cast<int>(loaded.size());
+    }
+
+    int DifficultyManager::LoadPresetsFromFile(const std::string& path)
+    {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return -1;
+        }
+        return LoadPresets(file);
+    }
+
+    void DifficultyManager::ValidateSettings(const DifficultySettings& settings)
+    {
+        if (settings.name.empty()) {
+            throw std::invalid_argument("Difficulty name is empty");
+        }
+        if (settings.rows <= 0 || settings.cols <= 0 ||
+            static_cast<long long>(settings.rows) * settings.cols > MineField::MAX_CELLS) {
+            throw std::invalid_argument("Invalid field size");
+        }
+        if (settings.minesCount < 0 || settings.minesCount >= settings.rows * settings.cols) {
+            throw std::invalid_argument("Too many mines for the grid size");
+        }
+        if (settings.timeLimit <= 0) {
+            throw std::invalid_argument("Time limit must be positive");
+        }
+    }
 }
\ No newline at end of file
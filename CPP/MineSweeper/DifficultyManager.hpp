@@ -2,6 +2,7 @@
 
 #include <string>
 #include <vector>
+#include <istream>
 
 namespace MineSweeper {
 
@@ -17,11 +18,15 @@ namespace MineSweeper {
         struct DifficultySettings
         {
             std::string name;
-            int gridSize;
+            int rows;
+            int cols;
             int minesCount;
             int timeLimit;
         };
 
+        // Файл пользовательских уровней рядом с программой
+        static constexpr const char* DEFAULT_PRESETS_FILE = "MineSweeperPresets.txt";
+
     private:
         std::vector<DifficultySettings> difficulties;
         int currentDifficulty;
@@ -47,6 +52,11 @@ namespace MineSweeper {
         /// </summary>
         const DifficultySettings& GetCurrentSettings() const;
 
+        /// <summary>
+        /// Возвращает настройки сложности по индексу
+        /// </summary>
+        const DifficultySettings& GetSettings(int index) const;
+
         /// <summary>
         /// Возвращает массив названий уровней сложности
         /// </summary>
@@ -61,5 +71,30 @@ namespace MineSweeper {
         /// Возвращает текущий индекс сложности
         /// </summary>
         int GetCurrentDifficulty() const { return currentDifficulty; }
+
+        /// <summary>
+        /// Добавляет уровень сложности; уровень с тем же именем заменяется.
+        /// Возвращает индекс уровня
+        /// </summary>
+        int AddDifficulty(const DifficultySettings& settings);
+
+        /// <summary>
+        /// Загружает пользовательские уровни из потока.
+        /// Формат строки: название;строки;столбцы;мины;лимит времени в секундах.
+        /// Пустые строки и строки, начинающиеся с '#', пропускаются
+        /// </summary>
+        int LoadPresets(std::istream& in);
+
+        /// <summary>
+        /// Загружает пользовательские уровни из файла.
+        /// Возвращает число загруженных уровней или -1, если файл не открылся
+        /// </summary>
+        int LoadPresetsFromFile(const std::string& path);
+
+    private:
+        /// <summary>
+        /// Проверяет корректность настроек уровня
+        /// </summary>
+        static void ValidateSettings(const DifficultySettings& settings);
     };
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+﻿#include "EventHistory.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace MineSweeper {
+
+    namespace {
+        // Строка и столбец занимают по 24 бита: MineField::MAX_CELLS не превышает 2^24
+        const int COORD_BITS = 24;
+        const uint64_t COORD_MASK = (uint64_t(1) << COORD_BITS) - 1;
+        const int COL_SHIFT = 0;
+        const int ROW_SHIFT = COORD_BITS;
+        const int HAS_CELL_SHIFT = COORD_BITS * 2;
+        const int TYPE_SHIFT = HAS_CELL_SHIFT + 8;
+    }
+
+    EventHistory::EventHistory()
+        : head(0), first(0)
+    {
+        for (auto& slot : slots)
+        {
+            slot.sequence.store(0, std::memory_order_relaxed);
+            slot.packed.store(0, std::memory_order_relaxed);
+            slot.timestamp.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    EventHistory::EventHistory(const EventHistory& other)
+        : EventHistory()
+    {
+        for (const auto& event : other.GetEvents())
+        {
+            Append(event);
+        }
+    }
+
+    EventHistory& EventHistory::operator=(const EventHistory& other)
+    {
+        if (this != &other)
+        {
+            std::vector<Event> events = other.GetEvents();
+            Clear();
+            for (const auto& event : events)
+            {
+                Append(event);
+            }
+        }
+        return *this;
+    }
+
+    void EventHistory::Record(EventType type, int row, int col)
+    {
+        long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        Append({ type, row, col, now });
+    }
+
+    void EventHistory::Append(const Event& event)
+    {
+        // Писатель один, поэтому head читается без синхронизации с другими писателями
+        const uint64_t index = head.load(std::memory_order_relaxed);
+        Slot& slot = slots[index % CAPACITY];
+
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.packed.store(Pack(event), std::memory_order_relaxed);
+        slot.timestamp.store(event.timestamp, std::memory_order_relaxed);
+        slot.sequence.store(index + 1, std::memory_order_release);
+
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    void EventHistory::Clear()
+    {
+        first.store(head.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    size_t EventHistory::GetCount() const
+    {
+        const uint64_t end = head.load(std::memory_order_acquire);
+        const uint64_t begin = std::max(first.load(std::memory_order_acquire), end > CAPACITY ? end - CAPACITY : 0);
+        return static_cast<size_t>(end - std::min(begin, end));
+    }
+
+    std::vector<EventHistory::Event> EventHistory::GetEvents() const
+    {
+        const uint64_t end = head.load(std::memory_order_acquire);
+        const uint64_t begin = std::max(first.load(std::memory_order_acquire), end > CAPACITY ? end - CAPACITY : 0);
+
+        std::vector<Event> events;
+        events.reserve(static_cast<size_t>(end - std::min(begin, end)));
+        for (uint64_t index = begin; index < end; index++)
+        {
+            const Slot& slot = slots[index % CAPACITY];
+
+            // Чтение по схеме seqlock: номер до и после копирования должен совпасть
+            const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            const uint64_t packed = slot.packed.load(std::memory_order_relaxed);
+            const int64_t timestamp = slot.timestamp.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+
+            if (before == index + 1 && after == before)
+            {
+                events.push_back(Unpack(packed, timestamp));
+            }
+        }
+        return events;
+    }
+
+    uint64_t EventHistory::Pack(const Event& event)
+    {
+        uint64_t packed = static_cast<uint64_t>(event.type) << TYPE_SHIFT;
+        if (event.row >= 0 && event.col >= 0)
+        {
+            packed |= uint64_t(1) << HAS_CELL_SHIFT;
+            packed |= (static_cast<uint64_t>(event.row) & COORD_MASK) << ROW_SHIFT;
+            packed |= (static_cast<uint64_t>(event.col) & COORD_MASK) << COL_SHIFT;
+        }
+        return packed;
+    }
+
+    EventHistory::Event EventHistory::Unpack(uint64_t packed, int64_t timestamp)
+    {
+        Event event;
+        event.type = static_cast<EventType>(packed >> TYPE_SHIFT);
+        bool hasCell = ((packed >> HAS_CELL_SHIFT) & 1) != 0;
+        event.row = hasCell ? static_cast<int>((packed >> ROW_SHIFT) & COORD_MASK) : -1;
+        event.col = hasCell ? static_cast<int>((packed >> COL_SHIFT) & COORD_MASK) : -1;
+        event.timestamp = timestamp;
+        return event;
+    }
+}
\ No newline at end of file
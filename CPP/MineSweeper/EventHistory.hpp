@@ -0,0 +1,99 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Кольцевой журнал событий партии фиксированной ёмкости.
+    /// Событие хранится в двух машинных словах (тип и клетка, отметка времени),
+    /// запись - несколько атомарных сохранений без выделения памяти.
+    /// Пишет один поток (интерфейс), читать можно из любого: каждая ячейка
+    /// защищена счётчиком последовательности, и перезаписанные во время чтения
+    /// события просто пропускаются
+    /// </summary>
+    class EventHistory
+    {
+    public:
+        /// <summary>
+        /// Тип события; текст для него формирует GameState при запросе истории
+        /// </summary>
+        enum class EventType : uint8_t
+        {
+            GameCreated = 0,
+            GameCopied = 1,
+            GameAssigned = 2,
+            GameRenamed = 3,
+            NewGameStarted = 4,
+            CellOpened = 5,
+            SteppedOnMine = 6,
+            FlagToggled = 7,
+            GameWon = 8,
+            GameLost = 9,
+            GameTimeUp = 10,
+            GameReset = 11,
+            MoveUndone = 12,
+            MoveRedone = 13
+        };
+
+        /// <summary>
+        /// Событие в распакованном виде. row и col равны -1, если событие не связано с клеткой
+        /// </summary>
+        struct Event
+        {
+            EventType type;
+            int row;
+            int col;
+            long long timestamp; // Миллисекунды с начала эпохи (system_clock)
+        };
+
+        // Ёмкость кольца: хранятся последние CAPACITY событий
+        static const uint64_t CAPACITY = 128;
+
+        EventHistory();
+        EventHistory(const EventHistory& other);
+        EventHistory& operator=(const EventHistory& other);
+
+        /// <summary>
+        /// Записывает событие с текущим временем
+        /// </summary>
+        void Record(EventType type, int row = -1, int col = -1);
+
+        /// <summary>
+        /// Записывает готовое событие (например, прочитанное из снимка)
+        /// </summary>
+        void Append(const Event& event);
+
+        /// <summary>
+        /// Забывает все события
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Число хранимых событий
+        /// </summary>
+        size_t GetCount() const;
+
+        /// <summary>
+        /// Копия хранимых событий от старых к новым
+        /// </summary>
+        std::vector<Event> GetEvents() const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence; // Номер события + 1; 0 - ячейка пишется
+            std::atomic<uint64_t> packed;   // Тип, флаг клетки, строка и столбец
+            std::atomic<int64_t> timestamp;
+        };
+
+        Slot slots[CAPACITY];
+        std::atomic<uint64_t> head;  // Номер следующего события
+        std::atomic<uint64_t> first; // Номер первого события после Clear
+
+        static uint64_t Pack(const Event& event);
+        static Event Unpack(uint64_t packed, int64_t timestamp);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+﻿#include "FieldViewport.hpp"
+#include <algorithm>
+
+namespace MineSweeper {
+
+    FieldViewport::FieldViewport(int viewWidth, int viewHeight, int minCellSize, int scrollBarSize)
+        : field(nullptr), viewWidth(viewWidth), viewHeight(viewHeight),
+        minCellSize(minCellSize), scrollBarSize(scrollBarSize), cellSize(minCellSize),
+        visibleRows(0), visibleCols(0), firstRow(0), firstCol(0),
+        needsRowScroll(false), needsColScroll(false), revealMines(false)
+    {
+        if (viewWidth < minCellSize || viewHeight < minCellSize || minCellSize <= 0) {
+            throw std::invalid_argument("Viewport is smaller than a cell");
+        }
+    }
+
+    void FieldViewport::Attach(const MineField& mineField)
+    {
+        field = &mineField;
+        revealMines = false;
+        firstRow = 0;
+        firstCol = 0;
+
+        int rows = field->GetRows();
+        int cols = field->GetCols();
+
+        // Клетки растягиваются на всё окно, но не мельче minCellSize
+        cellSize = std::max(minCellSize, std::min(viewWidth / cols, viewHeight / rows));
+
+        // Вторая итерация учитывает, что полоса по одной оси может потребовать полосу по другой
+        int width = viewWidth;
+        int height = viewHeight;
+        needsRowScroll = false;
+        needsColScroll = false;
+        for (int pass = 0; pass < 2; pass++)
+        {
+            width = needsRowScroll ? viewWidth - scrollBarSize : viewWidth;
+            height = needsColScroll ? viewHeight - scrollBarSize : viewHeight;
+            needsRowScroll = static_cast<long long>(rows) * cellSize > height;
+            needsColScroll = static_cast<long long>(cols) * cellSize > width;
+        }
+        width = needsRowScroll ? viewWidth - scrollBarSize : viewWidth;
+        height = needsColScroll ? viewHeight - scrollBarSize : viewHeight;
+
+        visibleRows = std::max(1, std::min(rows, height / cellSize));
+        visibleCols = std::max(1, std::min(cols, width / cellSize));
+    }
+
+    void FieldViewport::ScrollTo(int row, int col)
+    {
+        if (field == nullptr) return;
+
+        firstRow = std::clamp(row, 0, field->GetRows() - visibleRows);
+        firstCol = std::clamp(col, 0, field->GetCols() - visibleCols);
+    }
+
+    bool FieldViewport::EnsureVisible(int row, int col)
+    {
+        int newRow = firstRow;
+        int newCol = firstCol;
+
+        // Клетка вне окна выводится в его центр
+        if (row < firstRow || row >= firstRow + visibleRows)
+            newRow = row - visibleRows / 2;
+        if (col < firstCol || col >= firstCol + visibleCols)
+            newCol = col - visibleCols / 2;
+
+        if (newRow == firstRow && newCol == firstCol)
+            return false;
+
+        ScrollTo(newRow, newCol);
+        return true;
+    }
+
+    bool FieldViewport::ToSlot(int row, int col, int& slot) const
+    {
+        int r = row - firstRow;
+        int c = col - firstCol;
+        if (r < 0 || r >= visibleRows || c < 0 || c >= visibleCols)
+            return false;
+
+        slot = r * visibleCols + c;
+        return true;
+    }
+
+    void FieldViewport::FromSlot(int slot, int& row, int& col) const
+    {
+        row = firstRow + slot / visibleCols;
+        col = firstCol + slot % visibleCols;
+    }
+
+    FieldViewport::CellRender FieldViewport::GetRenderState(int slot) const
+    {
+        CellRender render;
+        FromSlot(slot, render.row, render.col);
+        render.visual = CellVisual::Closed;
+        render.minesAround = 0;
+
+        bool isMine = field->IsMine(render.row, render.col);
+        if (field->IsOpened(render.row, render.col))
+        {
+            if (isMine)
+            {
+                render.visual = CellVisual::ExplodedMine;
+            }
+            else
+            {
+                render.visual = CellVisual::Opened;
+                render.minesAround = field->CountMinesAround(render.row, render.col);
+            }
+        }
+        else if (revealMines && isMine)
+        {
+            render.visual = CellVisual::Mine;
+        }
+        else if (field->IsFlagged(render.row, render.col))
+        {
+            render.visual = CellVisual::Flagged;
+        }
+        return render;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+﻿#pragma once
+
+#include "MineField.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Модель представления поля: отображает прокручиваемое окно фиксированного
+    /// размера на MineField и выдаёт состояние отрисовки только видимых клеток.
+    /// Видимые клетки нумеруются слотами (row * visibleCols + col внутри окна),
+    /// поэтому интерфейс держит постоянный пул элементов независимо от размера поля
+    /// </summary>
+    class FieldViewport
+    {
+    public:
+        /// <summary>
+        /// Как выглядит клетка
+        /// </summary>
+        enum class CellVisual : char
+        {
+            Closed = 0,        // Закрыта
+            Flagged = 1,       // Закрыта, стоит флаг
+            Opened = 2,        // Открыта, minesAround - число
+            Mine = 3,          // Закрытая мина, показанная после окончания игры
+            ExplodedMine = 4   // Открытая мина
+        };
+
+        /// <summary>
+        /// Состояние отрисовки клетки
+        /// </summary>
+        struct CellRender
+        {
+            int row;
+            int col;
+            CellVisual visual;
+            int minesAround;
+        };
+
+        /// <summary>
+        /// Окно viewWidth x viewHeight пикселей; клетки не мельче minCellSize.
+        /// Полоса прокрутки по одной оси отнимает scrollBarSize у другой
+        /// </summary>
+        FieldViewport(int viewWidth, int viewHeight, int minCellSize, int scrollBarSize);
+
+        /// <summary>
+        /// Максимальное число слотов при любом поле: размер пула элементов интерфейса
+        /// </summary>
+        int GetMaxSlots() const { return (viewWidth / minCellSize) * (viewHeight / minCellSize); }
+
+        /// <summary>
+        /// Подключает поле: пересчитывает размер клеток и окно, сбрасывает прокрутку.
+        /// Стоимость не зависит от размера поля
+        /// </summary>
+        void Attach(const MineField& field);
+
+        /// <summary>
+        /// Показывать ли закрытые мины (после окончания игры)
+        /// </summary>
+        void SetRevealMines(bool reveal) { revealMines = reveal; }
+
+        int GetCellSize() const { return cellSize; }
+        int GetVisibleRows() const { return visibleRows; }
+        int GetVisibleCols() const { return visibleCols; }
+        int GetSlotCount() const { return visibleRows * visibleCols; }
+        int GetFirstRow() const { return firstRow; }
+        int GetFirstCol() const { return firstCol; }
+
+        /// <summary>
+        /// Нужна ли прокрутка по строкам (вертикальная) и по столбцам (горизонтальная)
+        /// </summary>
+        bool NeedsRowScroll() const { return needsRowScroll; }
+        bool NeedsColScroll() const { return needsColScroll; }
+
+        /// <summary>
+        /// Сдвигает окно; значения ограничиваются границами поля
+        /// </summary>
+        void ScrollTo(int row, int col);
+
+        /// <summary>
+        /// Сдвигает окно так, чтобы клетка оказалась видна. Возвращает true, если окно сдвинулось
+        /// </summary>
+        bool EnsureVisible(int row, int col);
+
+        /// <summary>
+        /// Слот видимой клетки; false, если клетка вне окна
+        /// </summary>
+        bool ToSlot(int row, int col, int& slot) const;
+
+        /// <summary>
+        /// Клетка поля, показанная в слоте
+        /// </summary>
+        void FromSlot(int slot, int& row, int& col) const;
+
+        /// <summary>
+        /// Состояние отрисовки клетки в слоте
+        /// </summary>
+        CellRender GetRenderState(int slot) const;
+
+    private:
+        const MineField* field;
+        int viewWidth;
+        int viewHeight;
+        int minCellSize;
+        int scrollBarSize;
+        int cellSize;
+        int visibleRows;
+        int visibleCols;
+        int firstRow;
+        int firstCol;
+        bool needsRowScroll;
+        bool needsColScroll;
+        bool revealMines;
+    };
+}
\ No newline at end of file
@@ -5,67 +5,50 @@
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#ifndef _M_CEE
+#include <thread>
+#endif
 #include "GameStatistics.hpp"
 
 namespace MineSweeper {
 
     /// <summary>
-    /// Абстрактный интерфейс для игровых объектов с именем
+    /// Шаблонный класс для управления коллекцией игровых объектов - таблица лидеров.
+    /// Имена уникальны и проиндексированы хеш-таблицей (поиск O(1)), очки кэшируются
+    /// в упорядоченном индексе при добавлении (лучшие K - O(K) без сортировки и без
+    /// виртуальных GetScore в сравнениях). Снаружи объекты доступны только для чтения;
+    /// менять их (в том числе имя) нужно через Modify, который переносит объект в обоих индексах.
+    /// Коллекции, собранные из частей списка игроков, объединяются через Merge,
+    /// а BuildParallel собирает части в нескольких потоках
     /// </summary>
-    class INamedObject {
-    public:
-        virtual ~INamedObject() = default;
-        virtual std::string GetName() const = 0;
-        virtual int GetScore() const = 0;
-    };
-
-    // Простые адаптеры в MineSweeper namespace
-    class StatisticsAdapter : public BaseStatistics, public INamedObject {
-    public:
-        StatisticsAdapter(const std::string& name = "Player") : BaseStatistics(name) {}
-
-        std::string GetName() const override {
-            return GetPlayerName();
-        }
-
-        int GetScore() const override {
-            return GetGamesPlayed();
-        }
-    };
-
-    class ExtendedStatisticsAdapter : public ExtendedStatistics, public INamedObject {
+    template<typename T>
+    class GameCollection {
     public:
-        ExtendedStatisticsAdapter(const std::string& name = "Player") : ExtendedStatistics(name) {}
-
-        std::string GetName() const override {
-            return GetPlayerName();
-        }
+        // Объединение двух записей одного игрока: into получает данные from
+        using Combiner = std::function<void(T& into, T& from)>;
 
-        int GetScore() const override {
-            return GetGamesPlayed() * 100 + GetBestTime();
-        }
-    };
+    private:
+        using ScoreIndex = std::multimap<int, T*, std::greater<int>>;
 
-    class TimedStatisticsAdapter : public TimedStatistics, public INamedObject {
-    public:
-        TimedStatisticsAdapter(const std::string& name = "Player") : TimedStatistics(name) {}
+        struct Entry {
+            size_t position;                          // Индекс в items
+            typename ScoreIndex::iterator scoreEntry; // Место в индексе очков
+        };
 
-        std::string GetName() const override {
-            return GetPlayerName();
-        }
+        // Объект и имя, под которым он записан в nameIndex
+        struct Slot {
+            std::unique_ptr<T> item;
+            std::string key;
+        };
 
-        int GetScore() const override {
-            return GetGamesPlayed() * 1000 + static_cast<int>(GetWinRate() * 100);
-        }
-    };
+        using NameIndex = std::unordered_map<std::string, Entry>;
 
-    /// <summary>
-    /// Шаблонный класс для управления коллекцией игровых объектов
-    /// </summary>
-    template<typename T>
-    class GameCollection {
-    private:
-        std::vector<std::unique_ptr<T>> items;
+        std::vector<Slot> items;
+        NameIndex nameIndex;
+        ScoreIndex scoreIndex;
         std::string collectionName;
 
     public:
@@ -74,6 +57,9 @@ namespace MineSweeper {
             : collectionName(name) {
         }
 
+        GameCollection(GameCollection&&) = default;
+        GameCollection& operator=(GameCollection&&) = default;
+
         // Нешаблонные методы
         std::string GetName() const { return collectionName; }
         void SetName(const std::string& name) { collectionName = name; }
@@ -81,67 +67,245 @@ namespace MineSweeper {
         size_t Size() const { return items.size(); }
         bool Empty() const { return items.empty(); }
 
-        // Методы для добавления
-        void Add(std::unique_ptr<T> item) {
-            items.push_back(std::move(item));
+        /// <summary>
+        /// Добавляет объект с новым именем. Если имя уже занято, коллекция не меняется,
+        /// объект уничтожается и возвращается false
+        /// </summary>
+        bool Add(std::unique_ptr<T> item) {
+            if (!item || nameIndex.count(item->GetName()) != 0) return false;
+            AddOrCombine(std::move(item), nullptr, false);
+            return true;
+        }
+
+        /// <summary>
+        /// Добавляет объект, заменяя прежний объект с тем же именем
+        /// </summary>
+        void AddOrReplace(std::unique_ptr<T> item) {
+            if (item) {
+                AddOrCombine(std::move(item), nullptr, true);
+            }
+        }
+
+        // Удаление по имени: последний элемент встаёт на место удалённого
+        bool Remove(const std::string& name) {
+            auto found = nameIndex.find(name);
+            if (found == nameIndex.end()) return false;
+            RemoveEntry(found);
+            return true;
         }
 
-        // Сортировка по score
+        /// <summary>
+        /// Изменяет объект и переносит его в индексах имён и очков.
+        /// Если новое имя занято другим объектом, тот удаляется, как при AddOrReplace.
+        /// Возвращает false, если объекта с именем name нет
+        /// </summary>
+        template<typename Change>
+        bool Modify(const std::string& name, Change&& change) {
+            auto found = nameIndex.find(name);
+            if (found == nameIndex.end()) return false;
+
+            change(*items[found->second.position].item);
+            Refile(found);
+            return true;
+        }
+
+        // Лучшие count объектов по убыванию очков
+        std::vector<const T*> GetTop(size_t count) const {
+            std::vector<const T*> top;
+            top.reserve(std::min(count, scoreIndex.size()));
+            for (auto it = scoreIndex.begin(); it != scoreIndex.end() && top.size() < count; ++it) {
+                top.push_back(it->second);
+            }
+            return top;
+        }
+
+        // Сортировка по score: порядок берётся из индекса, без сравнений
         void SortByScore() {
-            std::sort(items.begin(), items.end(),
-                [](const std::unique_ptr<T>& a, const std::unique_ptr<T>& b) {
-                    return a->GetScore() > b->GetScore();
-                });
+            std::vector<Slot> sorted;
+            sorted.reserve(items.size());
+            for (auto& [score, raw] : scoreIndex) {
+                auto& entry = nameIndex.find(raw->GetName())->second;
+                sorted.push_back(std::move(items[entry.position]));
+                entry.position = sorted.size() - 1;
+            }
+            items.swap(sorted);
         }
 
         // Сортировка по имени
         void SortByName() {
             std::sort(items.begin(), items.end(),
-                [](const std::unique_ptr<T>& a, const std::unique_ptr<T>& b) {
-                    return a->GetName() < b->GetName();
+                [](const Slot& a, const Slot& b) {
+                    return a.key < b.key;
                 });
+            RebuildPositions();
         }
 
         // Поиск по имени
-        T* FindByName(const std::string& name) {
-            SortByName();
-
-            auto it = std::lower_bound(items.begin(), items.end(), name,
-                [](const std::unique_ptr<T>& item, const std::string& name) {
-                    return item->GetName() < name;
-                });
-
-            if (it != items.end() && (*it)->GetName() == name) {
-                return it->get();
-            }
-            return nullptr;
+        const T* FindByName(const std::string& name) const {
+            auto found = nameIndex.find(name);
+            return found != nameIndex.end() ? items[found->second.position].item.get() : nullptr;
         }
 
         // Получение элемента
-        T* Get(size_t index) {
+        const T* Get(size_t index) const {
             if (index < items.size()) {
-                return items[index].get();
+                return items[index].item.get();
             }
             return nullptr;
         }
 
-        const T* Get(size_t index) const {
-            if (index < items.size()) {
-                return items[index].get();
+        // Обход в текущем порядке коллекции
+        template<typename Visitor>
+        void ForEach(Visitor&& visit) const {
+            for (const Slot& slot : items) {
+                visit(static_cast<const T&>(*slot.item));
             }
-            return nullptr;
+        }
+
+        /// <summary>
+        /// Забирает объекты другой коллекции. Для игрока, который есть в обеих,
+        /// вызывается combine; без него остаётся запись с большими очками
+        /// </summary>
+        void Merge(GameCollection&& other, const Combiner& combine = nullptr) {
+            items.reserve(items.size() + other.items.size());
+            nameIndex.reserve(nameIndex.size() + other.nameIndex.size());
+            for (auto& slot : other.items) {
+                AddOrCombine(std::move(slot.item), combine, false);
+            }
+            other.Clear();
+        }
+
+        /// <summary>
+        /// Собирает коллекцию из частей списка игроков: части индексируются не более чем
+        /// в hardware_concurrency потоках (каждый берёт части с шагом в число потоков),
+        /// затем объединяются попарно
+        /// </summary>
+        static GameCollection BuildParallel(std::vector<std::vector<std::unique_ptr<T>>> shards,
+            const std::string& name = "Collection", const Combiner& combine = nullptr) {
+            std::vector<GameCollection> parts(shards.size());
+            auto buildPart = [&](size_t index) {
+                GameCollection& part = parts[index];
+                part.items.reserve(shards[index].size());
+                part.nameIndex.reserve(shards[index].size());
+                for (auto& item : shards[index]) {
+                    if (item) {
+                        part.AddOrCombine(std::move(item), combine, false);
+                    }
+                }
+            };
+
+#ifndef _M_CEE
+            const size_t threadsCount = std::min<size_t>(shards.size(),
+                std::max(1u, std::thread::hardware_concurrency()));
+            std::vector<std::thread> workers;
+            workers.reserve(threadsCount);
+            for (size_t t = 0; t < threadsCount; t++) {
+                workers.emplace_back([&, t]() {
+                    for (size_t i = t; i < shards.size(); i += threadsCount) {
+                        buildPart(i);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+#else
+            // В управляемом коде std::thread недоступен: части собираются по очереди
+            for (size_t i = 0; i < shards.size(); i++) {
+                buildPart(i);
+            }
+#endif
+
+            // Попарное слияние: каждый объект переносится O(log частей) раз
+            for (size_t step = 1; step < parts.size(); step *= 2) {
+                for (size_t i = 0; i + step < parts.size(); i += step * 2) {
+                    if (parts[i].Size() < parts[i + step].Size()) {
+                        std::swap(parts[i], parts[i + step]);
+                    }
+                    parts[i].Merge(std::move(parts[i + step]), combine);
+                }
+            }
+
+            GameCollection result = parts.empty() ? GameCollection() : std::move(parts[0]);
+            result.SetName(name);
+            return result;
         }
 
         // Очистка
         void Clear() {
             items.clear();
+            nameIndex.clear();
+            scoreIndex.clear();
         }
 
-        // Итераторы
-        auto begin() { return items.begin(); }
-        auto end() { return items.end(); }
-        auto begin() const { return items.begin(); }
-        auto end() const { return items.end(); }
+    private:
+        // Новый объект добавляется; для известного имени вызывается combine,
+        // а без него объект заменяет прежний, если replace или у него больше очков
+        void AddOrCombine(std::unique_ptr<T> item, const Combiner& combine, bool replace) {
+            T* raw = item.get();
+            auto [found, inserted] = nameIndex.try_emplace(raw->GetName());
+            Entry& entry = found->second;
+
+            if (inserted) {
+                items.push_back({ std::move(item), found->first });
+                entry.position = items.size() - 1;
+                entry.scoreEntry = scoreIndex.emplace(raw->GetScore(), raw);
+            }
+            else if (combine) {
+                combine(*items[entry.position].item, *raw);
+                Refile(found);
+            }
+            else if (replace || raw->GetScore() > entry.scoreEntry->first) {
+                scoreIndex.erase(entry.scoreEntry);
+                items[entry.position].item = std::move(item);
+                entry.scoreEntry = scoreIndex.emplace(raw->GetScore(), raw);
+            }
+        }
+
+        void RemoveEntry(typename NameIndex::iterator found) {
+            size_t position = found->second.position;
+            scoreIndex.erase(found->second.scoreEntry);
+            nameIndex.erase(found);
+
+            if (position + 1 != items.size()) {
+                items[position] = std::move(items.back());
+                nameIndex.find(items[position].key)->second.position = position;
+            }
+            items.pop_back();
+        }
+
+        // Объект мог сменить очки и имя: переносим его в обоих индексах
+        void Refile(typename NameIndex::iterator found) {
+            Rescore(found->second);
+
+            const std::string oldKey = found->first;
+            const std::string newKey = items[found->second.position].item->GetName();
+            if (newKey == oldKey) return;
+
+            auto taken = nameIndex.find(newKey);
+            if (taken != nameIndex.end()) {
+                RemoveEntry(taken);
+            }
+
+            // После удаления объект мог переехать: позицию берём из индекса заново
+            auto own = nameIndex.find(oldKey);
+            Entry entry = own->second;
+            nameIndex.erase(own);
+            auto renamed = nameIndex.emplace(newKey, entry).first;
+            items[entry.position].key = renamed->first;
+        }
+
+        void Rescore(Entry& entry) {
+            T* raw = entry.scoreEntry->second;
+            scoreIndex.erase(entry.scoreEntry);
+            entry.scoreEntry = scoreIndex.emplace(raw->GetScore(), raw);
+        }
+
+        void RebuildPositions() {
+            for (size_t i = 0; i < items.size(); i++) {
+                nameIndex.find(items[i].key)->second.position = i;
+            }
+        }
     };
 
     // Специализация для интерфейса
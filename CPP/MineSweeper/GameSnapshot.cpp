@@ -0,0 +1,236 @@
+﻿#include "GameSnapshot.hpp"
+#include "MappedFile.hpp"
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace MineSweeper {
+
+    namespace {
+        const char SNAPSHOT_MAGIC[4] = { 'M', 'S', 'S', 'N' };
+    }
+
+    void GameSnapshot::PackPlane(const std::vector<std::vector<bool>>& plane, int cols, unsigned char* out)
+    {
+        // out уже обнулён: выставляются только единичные биты
+        size_t cell = 0;
+        for (const auto& row : plane)
+        {
+            for (int c = 0; c < cols; c++, cell++)
+            {
+                if (row[c])
+                {
+                    out[cell >> 3] |= static_cast<unsigned char>(1u << (cell & 7));
+                }
+            }
+        }
+    }
+
+    void GameSnapshot::UnpackPlane(const unsigned char* in, int rows, int cols, std::vector<std::vector<bool>>& plane)
+    {
+        plane.assign(rows, std::vector<bool>(cols, false));
+
+        // Плоскости открытых клеток и флагов почти пусты: нулевые байты пропускаются целиком
+        const size_t cellsCount = static_cast<size_t>(rows) * cols;
+        const size_t bytes = (cellsCount + 7) / 8;
+        for (size_t b = 0; b < bytes; b++)
+        {
+            unsigned bits = in[b];
+            while (bits != 0)
+            {
+                size_t cell = b * 8 + std::countr_zero(bits);
+                plane[cell / cols][cell % cols] = true;
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    void GameSnapshot::Save(const std::string& path, const MineField& field,
+        const GameState& state, const GameTimer& timer, int difficulty)
+    {
+        std::ostringstream randomState;
+        randomState << field.random;
+        const std::string randomText = randomState.str();
+
+        const std::vector<EventHistory::Event> history = state.gameHistory.GetEvents();
+        const uint64_t historySize = history.size() * sizeof(HistoryRecord);
+
+        const size_t cellsCount = static_cast<size_t>(field.rows) * field.cols;
+        const size_t planeBytes = (cellsCount + 7) / 8;
+
+        Header header = {};
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = FORMAT_VERSION;
+        header.headerSize = sizeof(Header);
+        header.rows = field.rows;
+        header.cols = field.cols;
+        header.minesCount = field.minesCount;
+        header.difficulty = difficulty;
+        header.generationMode = static_cast<uint8_t>(field.generationMode);
+        header.minesPlaced = field.minesPlaced ? 1 : 0;
+        header.gameStatus = static_cast<uint8_t>(state.currentStatus);
+        header.timerRunning = timer.isRunning ? 1 : 0;
+        header.elapsedTime = static_cast<int32_t>(timer.GetElapsedMilliseconds());
+        header.initialTime = static_cast<int32_t>(
+            std::chrono::duration_cast<std::chrono::seconds>(timer.timeLimit).count());
+        header.randomStateSize = static_cast<uint32_t>(randomText.size());
+        header.historyCount = static_cast<uint32_t>(history.size());
+        header.historySize = historySize;
+
+        // Весь снимок собирается в один буфер и пишется одним вызовом
+        std::vector<unsigned char> buffer(sizeof(Header) + planeBytes * 3 + randomText.size() + historySize, 0);
+        unsigned char* out = buffer.data();
+        std::memcpy(out, &header, sizeof(Header));
+        out += sizeof(Header);
+
+        PackPlane(field.mines, field.cols, out);
+        PackPlane(field.opened, field.cols, out + planeBytes);
+        PackPlane(field.flagged, field.cols, out + planeBytes * 2);
+        out += planeBytes * 3;
+
+        std::memcpy(out, randomText.data(), randomText.size());
+        out += randomText.size();
+
+        for (const auto& event : history) {
+            HistoryRecord record = {};
+            record.timestamp = event.timestamp;
+            record.row = event.row;
+            record.col = event.col;
+            record.type = static_cast<uint8_t>(event.type);
+            std::memcpy(out, &record, sizeof(record));
+            out += sizeof(record);
+        }
+
+        // Пишем во временный файл и подменяем: оборванная запись не портит прошлый снимок
+        const std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            if (!file) {
+                throw std::runtime_error("Cannot write snapshot file");
+            }
+        }
+        std::filesystem::rename(tempPath, path);
+    }
+
+    int GameSnapshot::Load(const std::string& path, MineField& field, GameState& state, GameTimer& timer)
+    {
+        MappedFile file(path);
+        const unsigned char* data = file.GetData();
+        const size_t size = file.GetSize();
+
+        Header header;
+        if (size < sizeof(Header)) {
+            throw std::invalid_argument("Snapshot file is truncated");
+        }
+        std::memcpy(&header, data, sizeof(Header));
+
+        if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+            throw std::invalid_argument("Not a MineSweeper snapshot");
+        }
+        if (header.version != FORMAT_VERSION || header.headerSize < sizeof(Header)) {
+            throw std::invalid_argument("Unsupported snapshot version");
+        }
+        if (header.rows <= 0 || header.cols <= 0 ||
+            static_cast<long long>(header.rows) * header.cols > MineField::MAX_CELLS ||
+            header.minesCount < 0 || header.minesCount >= header.rows * header.cols ||
+            header.generationMode > static_cast<uint8_t>(MineField::GenerationMode::NoGuess) ||
+            header.gameStatus > static_cast<uint8_t>(GameState::GameStatus::TimeUp) ||
+            header.initialTime < 0 || header.elapsedTime < 0) {
+            throw std::invalid_argument("Corrupted snapshot header");
+        }
+
+        const size_t cellsCount = static_cast<size_t>(header.rows) * header.cols;
+        const size_t planeBytes = (cellsCount + 7) / 8;
+        const size_t historyOffset = header.headerSize + planeBytes * 3 + header.randomStateSize;
+        if (size < historyOffset || size - historyOffset < header.historySize) {
+            throw std::invalid_argument("Snapshot file is truncated");
+        }
+
+        const unsigned char* planes = data + header.headerSize;
+
+        // Всё разбирается во временные объекты: при ошибке игра остаётся нетронутой
+        std::mt19937 random;
+        std::istringstream randomState(std::string(reinterpret_cast<const char*>(planes + planeBytes * 3),
+            header.randomStateSize));
+        randomState >> random;
+        if (randomState.fail()) {
+            throw std::invalid_argument("Corrupted random state in snapshot");
+        }
+
+        EventHistory history;
+        if (header.historySize != static_cast<uint64_t>(header.historyCount) * sizeof(HistoryRecord)) {
+            throw std::invalid_argument("Corrupted history in snapshot");
+        }
+        const unsigned char* entry = data + historyOffset;
+        for (uint32_t i = 0; i < header.historyCount; i++, entry += sizeof(HistoryRecord)) {
+            HistoryRecord record;
+            std::memcpy(&record, entry, sizeof(record));
+            if (record.type > static_cast<uint8_t>(EventHistory::EventType::MoveRedone) ||
+                record.row < -1 || record.row >= header.rows || record.col < -1 || record.col >= header.cols) {
+                throw std::invalid_argument("Corrupted history in snapshot");
+            }
+            history.Append({ static_cast<EventHistory::EventType>(record.type), record.row, record.col, record.timestamp });
+        }
+
+        // Биты за последней клеткой должны быть нулевыми, иначе распаковка вышла бы за поле
+        const unsigned paddingMask = (cellsCount % 8 == 0) ? 0u : (0xFFu << (cellsCount % 8)) & 0xFFu;
+        for (int plane = 0; plane < 3; plane++) {
+            if (planes[planeBytes * plane + planeBytes - 1] & paddingMask) {
+                throw std::invalid_argument("Corrupted field planes in snapshot");
+            }
+        }
+
+        // Мины и открытые клетки без мин считаются по упакованным байтам, не по клеткам
+        long long minesInPlane = 0;
+        int openedSafeCount = 0;
+        for (size_t b = 0; b < planeBytes; b++) {
+            minesInPlane += std::popcount(static_cast<unsigned>(planes[b]));
+            openedSafeCount += std::popcount(static_cast<unsigned>(planes[planeBytes + b] & ~planes[b]));
+        }
+
+        // До первого хода отложенных режимов мин на поле ещё нет
+        if (minesInPlane != (header.minesPlaced ? header.minesCount : 0)) {
+            throw std::invalid_argument("Mine count in snapshot does not match the field");
+        }
+
+        field.rows = header.rows;
+        field.cols = header.cols;
+        field.minesCount = header.minesCount;
+        UnpackPlane(planes, header.rows, header.cols, field.mines);
+        UnpackPlane(planes + planeBytes, header.rows, header.cols, field.opened);
+        UnpackPlane(planes + planeBytes * 2, header.rows, header.cols, field.flagged);
+        field.random = random;
+        field.generationMode = static_cast<MineField::GenerationMode>(header.generationMode);
+        field.minesPlaced = header.minesPlaced != 0;
+        field.openedSafeCount = openedSafeCount;
+        field.lastOpened.clear();
+        field.ClearJournal();
+
+        state.currentStatus = static_cast<GameState::GameStatus>(header.gameStatus);
+        state.gameHistory = history;
+
+        // Отсчёт продолжается с момента загрузки: время, пока игра была закрыта, не учитывается
+        timer.timeLimit = std::chrono::seconds(header.initialTime);
+        timer.accumulated = std::chrono::milliseconds(header.elapsedTime);
+        timer.startedAt = GameTimer::Clock::now();
+        timer.isRunning = header.timerRunning != 0;
+
+        return header.difficulty;
+    }
+
+    bool GameSnapshot::Exists(const std::string& path)
+    {
+        std::error_code error;
+        return std::filesystem::exists(path, error);
+    }
+
+    void GameSnapshot::Remove(const std::string& path)
+    {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+﻿#pragma once
+
+#include <string>
+#include <cstdint>
+#include "MineField.hpp"
+#include "GameState.hpp"
+#include "GameTimer.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Двоичный снимок партии: поле (битовые плоскости мин, открытых клеток и флагов),
+    /// состояние генератора, таймер, статус и история.
+    /// Снимок пишется одним буфером, а читается через отображение файла в память,
+    /// поэтому сохранение и загрузка даже огромных полей занимают миллисекунды
+    /// </summary>
+    class GameSnapshot
+    {
+    public:
+        // Версия формата; при изменении разметки увеличивается, снимки других версий не читаются
+        static const uint32_t FORMAT_VERSION = 1;
+
+        // Файл автосохранения незаконченной партии
+        static constexpr const char* DEFAULT_SAVE_FILE = "MineSweeperSave.bin";
+
+        /// <summary>
+        /// Сохраняет партию. difficulty - индекс уровня в DifficultyManager (или -1).
+        /// Файл заменяется целиком только после успешной записи
+        /// </summary>
+        static void Save(const std::string& path, const MineField& field,
+            const GameState& state, const GameTimer& timer, int difficulty = -1);
+
+        /// <summary>
+        /// Загружает партию в существующие объекты и возвращает сохранённый индекс уровня.
+        /// При ошибке формата (в том числе если число мин в плоскости не совпадает с заголовком)
+        /// бросает исключение, не изменяя объекты
+        /// </summary>
+        static int Load(const std::string& path, MineField& field, GameState& state, GameTimer& timer);
+
+        /// <summary>
+        /// Есть ли файл снимка
+        /// </summary>
+        static bool Exists(const std::string& path);
+
+        /// <summary>
+        /// Удаляет файл снимка (если он есть)
+        /// </summary>
+        static void Remove(const std::string& path);
+
+    private:
+        /// <summary>
+        /// Заголовок файла; за ним идут три битовые плоскости по (rows * cols + 7) / 8 байт,
+        /// состояние генератора и historyCount записей HistoryRecord
+        /// </summary>
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t headerSize;
+            int32_t rows;
+            int32_t cols;
+            int32_t minesCount;
+            int32_t difficulty;
+            uint8_t generationMode;
+            uint8_t minesPlaced;
+            uint8_t gameStatus;
+            uint8_t timerRunning;
+            int32_t elapsedTime;   // Прошедшие миллисекунды
+            int32_t initialTime;   // Лимит времени в секундах
+            uint32_t randomStateSize;
+            uint32_t historyCount;
+            uint64_t historySize;
+        };
+        static_assert(sizeof(Header) == 56, "Snapshot header layout changed");
+
+        /// <summary>
+        /// Событие истории в файле
+        /// </summary>
+        struct HistoryRecord
+        {
+            int64_t timestamp;
+            int32_t row;
+            int32_t col;
+            uint8_t type;
+            uint8_t reserved[7];
+        };
+        static_assert(sizeof(HistoryRecord) == 24, "Snapshot history record layout changed");
+
+        static void PackPlane(const std::vector<std::vector<bool>>& plane, int cols, unsigned char* out);
+        static void UnpackPlane(const unsigned char* in, int rows, int cols, std::vector<std::vector<bool>>& plane);
+    };
+}
\ No newline at end of file
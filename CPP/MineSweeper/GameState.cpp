@@ -11,13 +11,13 @@ namespace MineSweeper {
         difficultyManager = std::make_unique<DifficultyManager>();
         auto settings = difficultyManager->GetCurrentSettings();
         gameTimer = std::make_shared<GameTimer>(settings.timeLimit);
-        AddToHistory("Game created");
+        gameHistory.Record(EventHistory::EventType::GameCreated);
     }
 
     GameState::GameState(const std::string& name)
         : currentStatus(GameStatus::Playing), gameName(name)
     {
-        AddToHistory("Game created with name: " + name);
+        gameHistory.Record(EventHistory::EventType::GameCreated);
     }
 
     GameState::GameState(const GameState& other)
@@ -25,7 +25,7 @@ namespace MineSweeper {
         gameName(other.gameName + " (Copy)"),
         gameHistory(other.gameHistory)
     {
-        AddToHistory("Game copied from: " + other.gameName);
+        gameHistory.Record(EventHistory::EventType::GameCopied);
     }
 
     GameState& GameState::operator=(const GameState& other)
@@ -34,7 +34,7 @@ namespace MineSweeper {
             currentStatus = other.currentStatus;
             gameName = other.gameName + " (Assigned)";
             gameHistory = other.gameHistory;
-            AddToHistory("Game assigned from: " + other.gameName);
+            gameHistory.Record(EventHistory::EventType::GameAssigned);
         }
         return *this;
     }
@@ -49,14 +49,14 @@ namespace MineSweeper {
         std::ostringstream oss;
         oss << "GameState: " << gameName
             << ", Status: " << GetStatusDescription(currentStatus)
-            << ", History entries: " << gameHistory.size();
+            << ", History entries: " << gameHistory.GetCount();
         return oss.str();
     }
 
-    std::string GameState::GetCurrentTimeString() const
+    std::string GameState::FormatTimestamp(long long timestamp)
     {
-        std::time_t now = std::time(nullptr);
-        std::tm* localTime = std::localtime(&now);
+        std::time_t time = static_cast<std::time_t>(timestamp / 1000);
+        std::tm* localTime = std::localtime(&time);
 
         std::ostringstream oss;
         oss << std::put_time(localTime, "%Y-%m-%d %H:%M:%S");
@@ -73,70 +73,102 @@ namespace MineSweeper {
         return gameTimer->GetTimeLeft();
     }
 
-    void GameState::AddToHistory(const std::string& event)
-    {
-        std::string timeStr = GetCurrentTimeString();
-        std::string entry = timeStr + " - " + event;
-
-        gameHistory.push_back(entry);
-
-        // Ограничиваем историю 100 записями
-        if (gameHistory.size() > 100) {
-            gameHistory.erase(gameHistory.begin());
-        }
-    }
-
     std::string GameState::GetFullHistory() const
     {
         std::ostringstream oss;
         oss << "Game History for: " << gameName << "\n";
         oss << std::string(40, '=') << "\n";
 
-        for (const auto& entry : gameHistory) {
-            oss << entry << "\n";
+        for (const auto& event : gameHistory.GetEvents()) {
+            oss << FormatTimestamp(event.timestamp) << " - " << FormatHistoryEntry(event) << "\n";
         }
 
         return oss.str();
     }
 
-    std::string GameState::FormatHistoryEntry(const std::string& event) const
+    std::string GameState::FormatHistoryEntry(const EventHistory::Event& event) const
     {
-        // Конкатенация строк
-        std::string prefix = "[HISTORY] ";
-        return prefix + event;
+        std::string text;
+        switch (event.type)
+        {
+        case EventHistory::EventType::GameCreated:    text = "Game created"; break;
+        case EventHistory::EventType::GameCopied:     text = "Game copied"; break;
+        case EventHistory::EventType::GameAssigned:   text = "Game assigned"; break;
+        case EventHistory::EventType::GameRenamed:    text = "Game renamed"; break;
+        case EventHistory::EventType::NewGameStarted: text = "New game started"; break;
+        case EventHistory::EventType::CellOpened:     text = "Cell opened successfully"; break;
+        case EventHistory::EventType::SteppedOnMine:  text = "Player stepped on a mine!"; break;
+        case EventHistory::EventType::FlagToggled:    text = "Flag toggled"; break;
+        case EventHistory::EventType::GameWon:        text = "Game ended: " + GetStatusDescription(GameStatus::Won); break;
+        case EventHistory::EventType::GameLost:       text = "Game ended: " + GetStatusDescription(GameStatus::Lost); break;
+        case EventHistory::EventType::GameTimeUp:     text = "Game ended: " + GetStatusDescription(GameStatus::TimeUp); break;
+        case EventHistory::EventType::GameReset:      text = "Game reset"; break;
+        case EventHistory::EventType::MoveUndone:     text = "Move undone"; break;
+        case EventHistory::EventType::MoveRedone:     text = "Move redone"; break;
+        default:                                      text = "Unknown event"; break;
+        }
+
+        if (event.row >= 0)
+        {
+            text += " (" + std::to_string(event.row + 1) + ", " + std::to_string(event.col + 1) + ")";
+        }
+        return text;
     }
 
     void GameState::SetGameName(const std::string& name)
     {
         if (!name.empty() && name != gameName) {
-            std::string oldName = gameName;
             gameName = name;
-            AddToHistory("Game renamed from '" + oldName + "' to '" + name + "'");
+            gameHistory.Record(EventHistory::EventType::GameRenamed);
         }
     }
 
     void GameState::StartNewGame()
     {
         currentStatus = GameStatus::Playing;
-        AddToHistory("New game started");
+        gameHistory.Record(EventHistory::EventType::NewGameStarted);
     }
 
-    void GameState::ProcessCellOpen(bool wasMine)
+    void GameState::ProcessCellOpen(bool wasMine, int row, int col)
     {
         if (currentStatus != GameStatus::Playing)
             return;
 
         if (wasMine)
         {
-            AddToHistory("Player stepped on a mine!");
+            gameHistory.Record(EventHistory::EventType::SteppedOnMine, row, col);
             EndGame(GameStatus::Lost);
         }
         else
         {
-            AddToHistory("Cell opened successfully");
+            gameHistory.Record(EventHistory::EventType::CellOpened, row, col);
         }
     }
 
+    void GameState::ProcessFlagToggle(int row, int col)
+    {
+        if (currentStatus != GameStatus::Playing)
+            return;
+
+        gameHistory.Record(EventHistory::EventType::FlagToggled, row, col);
+    }
+
+    void GameState::ProcessUndo()
+    {
+        if (currentStatus != GameStatus::Playing)
+            return;
+
+        gameHistory.Record(EventHistory::EventType::MoveUndone);
+    }
+
+    void GameState::ProcessRedo()
+    {
+        if (currentStatus != GameStatus::Playing)
+            return;
+
+        gameHistory.Record(EventHistory::EventType::MoveRedone);
+    }
+
     void GameState::CheckGameCompletion(bool hasWon, bool isTimeUp)
     {
         if (currentStatus != GameStatus::Playing)
@@ -155,15 +187,20 @@ namespace MineSweeper {
     void GameState::EndGame(GameStatus status)
     {
         currentStatus = status;
-        std::string statusStr = GetStatusDescription(status);
-        AddToHistory("Game ended: " + statusStr);
+        switch (status)
+        {
+        case GameStatus::Won:    gameHistory.Record(EventHistory::EventType::GameWon); break;
+        case GameStatus::Lost:   gameHistory.Record(EventHistory::EventType::GameLost); break;
+        case GameStatus::TimeUp: gameHistory.Record(EventHistory::EventType::GameTimeUp); break;
+        default: break;
+        }
     }
 
     void GameState::Reset()
     {
         currentStatus = GameStatus::Playing;
-        gameHistory.clear();
-        AddToHistory("Game reset");
+        gameHistory.Clear();
+        gameHistory.Record(EventHistory::EventType::GameReset);
     }
 
     std::string GameState::GetStatusDescription(GameStatus status)
@@ -7,6 +7,7 @@
 #include <sstream>
 #include <iomanip>
 #include "GameTimer.hpp"
+#include "EventHistory.hpp"
 #include "DifficultyManager.hpp"
 
 namespace MineSweeper {
@@ -28,7 +29,7 @@ namespace MineSweeper {
     private:
         GameStatus currentStatus;
         std::string gameName;
-        std::vector<std::string> gameHistory;
+        EventHistory gameHistory; // Двоичные события; текст собирается в GetFullHistory
         std::shared_ptr<GameTimer> gameTimer;
         std::unique_ptr<DifficultyManager> difficultyManager;
 
@@ -50,7 +51,12 @@ namespace MineSweeper {
 
         // Остальные методы
         void StartNewGame();
-        void ProcessCellOpen(bool wasMine);
+        void ProcessCellOpen(bool wasMine, int row = -1, int col = -1);
+        void ProcessFlagToggle(int row, int col);
+
+        // Отмена и повтор хода попадают в историю отдельными событиями
+        void ProcessUndo();
+        void ProcessRedo();
         void CheckGameCompletion(bool hasWon, bool isTimeUp);
         void EndGame(GameStatus status);
         void Reset();
@@ -58,9 +64,9 @@ namespace MineSweeper {
         GameStatus GetCurrentStatus() const { return currentStatus; }
         bool IsGameActive() const { return currentStatus == GameStatus::Playing; }
 
-        // Работа со строками
-        void AddToHistory(const std::string& event);
+        // Работа с историей: события хранятся в двоичном виде и форматируются по запросу
         std::string GetFullHistory() const;
+        const EventHistory& GetHistory() const { return gameHistory; }
         void SetGameName(const std::string& name);
         std::string GetGameName() const { return gameName; }
 
@@ -68,8 +74,11 @@ namespace MineSweeper {
         int GetCurrentDifficulty();
         int GetTimeLeft();
 
+        // Снимок партии сохраняет статус и историю
+        friend class GameSnapshot;
+
     private:
-        std::string FormatHistoryEntry(const std::string& event) const;
-        std::string GetCurrentTimeString() const;
+        std::string FormatHistoryEntry(const EventHistory::Event& event) const;
+        static std::string FormatTimestamp(long long timestamp);
     };
 }
\ No newline at end of file
@@ -18,7 +18,12 @@ namespace MineSweeper {
     BaseStatistics::BaseStatistics(const BaseStatistics& other)
         : playerName(other.playerName + " (Copied)"), gamesPlayed(other.gamesPlayed)
     {
-        std::cout << "BaseStatistics copy constructor\n";
+    }
+
+    // Перемещение не меняет имя и ничего не печатает: используется при перестройке коллекций
+    BaseStatistics::BaseStatistics(BaseStatistics&& other) noexcept
+        : playerName(std::move(other.playerName)), gamesPlayed(other.gamesPlayed)
+    {
     }
 
     BaseStatistics::~BaseStatistics()
@@ -35,6 +40,15 @@ namespace MineSweeper {
         return *this;
     }
 
+    BaseStatistics& BaseStatistics::operator=(BaseStatistics&& other) noexcept
+    {
+        if (this != &other) {
+            playerName = std::move(other.playerName);
+            gamesPlayed = other.gamesPlayed;
+        }
+        return *this;
+    }
+
     void BaseStatistics::AddGameResult(bool won)
     {
         gamesPlayed++;
@@ -69,14 +83,14 @@ namespace MineSweeper {
     // ==================== ExtendedStatistics ====================
 
     ExtendedStatistics::ExtendedStatistics(const std::string& name)
-        : BaseStatistics(name), gamesWon(0), bestTime(0), gameResults(new std::vector<bool>())
+        : BaseStatistics(name), gamesWon(0), bestTime(0)
     {
         std::cout << "ExtendedStatistics constructor for " << name << "\n";
     }
 
     ExtendedStatistics::ExtendedStatistics(const BaseStatistics& base)
         : BaseStatistics(base), // Вызов конструктора базового класса с параметрами
-        gamesWon(0), bestTime(0), gameResults(new std::vector<bool>())
+        gamesWon(0), bestTime(0)
     {
         playerName = playerName + " (Extended)";
         std::cout << "ExtendedStatistics constructor from BaseStatistics\n";
@@ -86,15 +100,22 @@ namespace MineSweeper {
         : BaseStatistics(other), // Вызов конструктора копирования базового класса
         gamesWon(other.gamesWon),
         bestTime(other.bestTime),
-        gameTimes(other.gameTimes),
-        gameResults(new std::vector<bool>(*other.gameResults)) // Глубокое копирование
+        gameTimes(other.gameTimes),   // Истории не копируются: буферы общие до первой записи
+        gameResults(other.gameResults)
+    {
+    }
+
+    ExtendedStatistics::ExtendedStatistics(ExtendedStatistics&& other) noexcept
+        : BaseStatistics(std::move(other)),
+        gamesWon(other.gamesWon),
+        bestTime(other.bestTime),
+        gameTimes(std::move(other.gameTimes)),
+        gameResults(std::move(other.gameResults))
     {
-        std::cout << "ExtendedStatistics deep copy constructor\n";
     }
 
     ExtendedStatistics::~ExtendedStatistics()
     {
-        delete gameResults;
         std::cout << "ExtendedStatistics destructor for " << playerName << "\n";
     }
 
@@ -104,10 +125,8 @@ namespace MineSweeper {
         BaseStatistics::operator=(base);
         gamesWon = 0;
         bestTime = 0;
-        gameTimes.clear();
-        if (gameResults) {
-            gameResults->clear();
-        }
+        gameTimes.Clear();
+        gameResults.Clear();
         return *this;
     }
 
@@ -118,10 +137,19 @@ namespace MineSweeper {
             gamesWon = other.gamesWon;
             bestTime = other.bestTime;
             gameTimes = other.gameTimes;
-            if (gameResults) {
-                delete gameResults;
-            }
-            gameResults = new std::vector<bool>(*other.gameResults); // Глубокое копирование
+            gameResults = other.gameResults;
+        }
+        return *this;
+    }
+
+    ExtendedStatistics& ExtendedStatistics::operator=(ExtendedStatistics&& other) noexcept
+    {
+        if (this != &other) {
+            BaseStatistics::operator=(std::move(other));
+            gamesWon = other.gamesWon;
+            bestTime = other.bestTime;
+            gameTimes = std::move(other.gameTimes);
+            gameResults = std::move(other.gameResults);
         }
         return *this;
     }
@@ -133,9 +161,7 @@ namespace MineSweeper {
         if (won) {
             gamesWon++;
         }
-        if (gameResults) {
-            gameResults->push_back(won);
-        }
+        gameResults.PushBack(won);
         std::cout << "ExtendedStatistics: Game added with win=" << won
             << ". Win rate: " << GetWinRate() * 100 << "%\n";
     }
@@ -147,13 +173,11 @@ namespace MineSweeper {
         if (won) {
             gamesWon++;
             if (time > 0) {
-                gameTimes.push_back(time);
+                gameTimes.PushBack(time);
                 UpdateBestTime(time);
             }
         }
-        if (gameResults) {
-            gameResults->push_back(won);
-        }
+        gameResults.PushBack(won);
     }
 
     std::string ExtendedStatistics::GetSummary() const
@@ -163,13 +187,13 @@ namespace MineSweeper {
         oss << baseSummary
             << ", Won: " << gamesWon
             << ", Win Rate: " << GetWinRate() * 100 << "%"
-            << ", Best Time: " << bestTime << "s";
+            << ", Best Time: " << std::fixed << std::setprecision(3) << bestTime / 1000.0 << "s";
         return oss.str();
     }
 
     ExtendedStatistics* ExtendedStatistics::Clone() const
     {
-        // Глубокое клонирование
+        // Клонирование O(1): истории копируются только при изменении клона или оригинала
         return new ExtendedStatistics(*this);
     }
 
@@ -190,9 +214,7 @@ namespace MineSweeper {
             << GetSummary() << "\n"
             << "Total games: " << gamesPlayed << "\n"
             << "Games won: " << gamesWon << "\n";
-        if (gameResults) {
-            oss << "Game results recorded: " << gameResults->size() << "\n";
-        }
+        oss << "Game results recorded: " << gameResults.Size() << "\n";
         return oss.str();
     }
 
@@ -206,14 +228,20 @@ namespace MineSweeper {
     // ==================== TimedStatistics ====================
 
     TimedStatistics::TimedStatistics(const std::string& name)
-        : ExtendedStatistics(name), averageTime(0.0)
+        : ExtendedStatistics(name), averageTime(0.0), timedGamesAveraged(0)
     {
         std::cout << "TimedStatistics constructor for " << name << "\n";
     }
 
     TimedStatistics::TimedStatistics(const ExtendedStatistics& base)
-        : ExtendedStatistics(base), averageTime(0.0) // Вызов конструктора базового класса
+        : ExtendedStatistics(base), averageTime(0.0), timedGamesAveraged(0) // Вызов конструктора базового класса
     {
+        // Времена базовой статистики учитываются сразу
+        if (!gameTimes.Empty()) {
+            const std::vector<int>& times = gameTimes.Get();
+            averageTime = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+            timedGamesAveraged = times.size();
+        }
         playerName = playerName + " (Timed)";
         std::cout << "TimedStatistics constructor from ExtendedStatistics\n";
     }
@@ -221,16 +249,16 @@ namespace MineSweeper {
     TimedStatistics::TimedStatistics(const TimedStatistics& other)
         : ExtendedStatistics(other), // Вызов конструктора копирования базового класса
         gameDates(other.gameDates),
-        averageTime(other.averageTime)
+        averageTime(other.averageTime),
+        timedGamesAveraged(other.timedGamesAveraged)
     {
-        std::cout << "TimedStatistics copy constructor\n";
     }
 
     void TimedStatistics::AddGameResult(bool won, int time, const std::string& date)
     {
         // Вызов метода базового класса
         ExtendedStatistics::AddGameResult(won, time);
-        gameDates.push_back(date);
+        gameDates.PushBack(date);
         CalculateAverageTime();
     }
 
@@ -241,7 +269,7 @@ namespace MineSweeper {
         oss << "Timed Statistics for " << playerName << "\n"
             << "Games: " << gamesPlayed
             << ", Won: " << gamesWon
-            << ", Avg Time: " << averageTime << "s";
+            << ", Avg Time: " << std::fixed << std::setprecision(3) << averageTime / 1000.0 << "s";
         return oss.str();
     }
 
@@ -253,9 +281,9 @@ namespace MineSweeper {
         std::ostringstream oss;
         oss << baseReport
             << "\n=== Time Analysis ===\n"
-            << "Average time: " << averageTime << "s\n"
-            << "Game dates recorded: " << gameDates.size() << "\n"
-            << "Timeline available: " << (!gameDates.empty() ? "Yes" : "No");
+            << "Average time: " << std::fixed << std::setprecision(3) << averageTime / 1000.0 << "s\n"
+            << "Game dates recorded: " << gameDates.Size() << "\n"
+            << "Timeline available: " << (!gameDates.Empty() ? "Yes" : "No");
         return oss.str();
     }
 
@@ -263,20 +291,22 @@ namespace MineSweeper {
     {
         std::ostringstream oss;
         oss << "=== Game Timeline ===\n";
-        for (size_t i = 0; i < gameDates.size() && i < 5; ++i) {
-            oss << "Game " << (i + 1) << ": " << gameDates[i] << "\n";
+        const std::vector<std::string>& dates = gameDates.Get();
+        for (size_t i = 0; i < dates.size() && i < 5; ++i) {
+            oss << "Game " << (i + 1) << ": " << dates[i] << "\n";
         }
-        if (gameDates.size() > 5) {
-            oss << "... and " << (gameDates.size() - 5) << " more games\n";
+        if (dates.size() > 5) {
+            oss << "... and " << (dates.size() - 5) << " more games\n";
         }
         return oss.str();
     }
 
     void TimedStatistics::CalculateAverageTime()
     {
-        if (!gameTimes.empty()) {
-            double sum = std::accumulate(gameTimes.begin(), gameTimes.end(), 0.0);
-            averageTime = sum / gameTimes.size();
+        // Бегущее среднее: учитывается только последнее добавленное время, без прохода по истории
+        if (gameTimes.Size() > timedGamesAveraged) {
+            timedGamesAveraged = gameTimes.Size();
+            averageTime += (gameTimes.Back() - averageTime) / timedGamesAveraged;
         }
     }
 }
\ No newline at end of file
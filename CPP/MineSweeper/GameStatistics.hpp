@@ -2,12 +2,62 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
 
 namespace MineSweeper {
 
+    /// <summary>
+    /// История значений с копированием при записи: копии объекта статистики
+    /// разделяют один буфер, и он копируется только при первом изменении копии.
+    /// Пустая история не выделяет память.
+    /// Копии можно держать в разных потоках, но один объект истории
+    /// без внешней синхронизации используется только из одного потока
+    /// </summary>
+    template<typename T>
+    class SharedHistory
+    {
+    public:
+        const std::vector<T>& Get() const
+        {
+            static const std::vector<T> empty;
+            return data ? *data : empty;
+        }
+
+        size_t Size() const { return data ? data->size() : 0; }
+        bool Empty() const { return Size() == 0; }
+        const T& Back() const { return data->back(); }
+
+        void PushBack(const T& value)
+        {
+            Detach();
+            data->push_back(value);
+        }
+
+        // Общий буфер не трогается: копия просто отпускает его
+        void Clear() { data.reset(); }
+
+    private:
+        std::shared_ptr<std::vector<T>> data;
+
+        void Detach()
+        {
+            if (!data) {
+                data = std::make_shared<std::vector<T>>();
+            }
+            else if (data.use_count() > 1) {
+                data = std::make_shared<std::vector<T>>(*data);
+            }
+            else {
+                // use_count читается без упорядочивания: барьер гарантирует,
+                // что чтения буфера копией из другого потока завершились до нашей записи
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+        }
+    };
+
     /// <summary>
     /// Базовый класс для статистики
     /// </summary>
@@ -20,9 +70,11 @@ namespace MineSweeper {
     public:
         BaseStatistics(const std::string& name = "Player");
         BaseStatistics(const BaseStatistics& other); // Восстанавливаем конструктор копирования
+        BaseStatistics(BaseStatistics&& other) noexcept;
         virtual ~BaseStatistics(); // Виртуальный деструктор
 
         BaseStatistics& operator=(const BaseStatistics& other);
+        BaseStatistics& operator=(BaseStatistics&& other) noexcept;
 
         // Виртуальные методы
         virtual void AddGameResult(bool won);
@@ -50,24 +102,26 @@ namespace MineSweeper {
     {
     protected:
         int gamesWon;
-        int bestTime;
-        std::vector<int> gameTimes;
-        std::vector<bool>* gameResults; // Для демонстрации глубокого клонирования
+        int bestTime;                  // Лучшее время победы, мс
+        SharedHistory<int> gameTimes;  // Время побед, мс
+        SharedHistory<bool> gameResults; // Общая у копий до первого изменения
 
     public:
         ExtendedStatistics(const std::string& name = "Player");
         ExtendedStatistics(const BaseStatistics& base); // Конструктор с вызовом базового
-        ExtendedStatistics(const ExtendedStatistics& other); // Конструктор глубокого копирования
+        ExtendedStatistics(const ExtendedStatistics& other); // Копирование O(1): истории общие
+        ExtendedStatistics(ExtendedStatistics&& other) noexcept;
         ~ExtendedStatistics() override;
 
         ExtendedStatistics& operator=(const BaseStatistics& base); // Перегрузка оператора присваивания
         ExtendedStatistics& operator=(const ExtendedStatistics& other);
+        ExtendedStatistics& operator=(ExtendedStatistics&& other) noexcept;
 
         // Перегрузка виртуальных методов (с вызовом базового и без)
         void AddGameResult(bool won) override; // Без вызова базового
-        void AddGameResult(bool won, int time); // С вызовом базового
+        void AddGameResult(bool won, int time); // С вызовом базового; time в миллисекундах
         std::string GetSummary() const override;
-        ExtendedStatistics* Clone() const override; // Перегрузка метода клонирования
+        ExtendedStatistics* Clone() const override; // Клон разделяет истории до первого изменения
 
         // Перегрузка оператора преобразования
         operator std::string() const;
@@ -88,13 +142,17 @@ namespace MineSweeper {
     class TimedStatistics : public ExtendedStatistics
     {
     private:
-        std::vector<std::string> gameDates;
-        double averageTime;
+        SharedHistory<std::string> gameDates;
+        double averageTime; // мс
+        size_t timedGamesAveraged; // Сколько времён уже вошло в averageTime
 
     public:
         TimedStatistics(const std::string& name = "Player");
         TimedStatistics(const ExtendedStatistics& base);
         TimedStatistics(const TimedStatistics& other); // Конструктор копирования
+        TimedStatistics(TimedStatistics&& other) noexcept = default;
+        TimedStatistics& operator=(const TimedStatistics& other) = default;
+        TimedStatistics& operator=(TimedStatistics&& other) noexcept = default;
 
         void AddGameResult(bool won, int time, const std::string& date);
         std::string GetSummary() const override; // Перегрузка без вызова базового
@@ -1,36 +1,64 @@
 #include "GameTimer.hpp"
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
 namespace MineSweeper {
 
     GameTimer::GameTimer(int initialTimeSeconds)
-        : initialTime(initialTimeSeconds), timeLeft(initialTimeSeconds), isRunning(false)
+        : timeLimit(std::chrono::seconds(initialTimeSeconds)), accumulated(Clock::duration::zero()),
+        startedAt(), isRunning(false)
     {
     }
 
-    void GameTimer::Update()
+    void GameTimer::Start()
     {
-        if (isRunning && timeLeft > 0)
+        if (!isRunning)
         {
-            timeLeft--;
+            startedAt = Clock::now();
+            isRunning = true;
         }
     }
 
-    void GameTimer::Start()
+    void GameTimer::Stop()
     {
-        isRunning = true;
+        if (isRunning)
+        {
+            accumulated += Clock::now() - startedAt;
+            isRunning = false;
+        }
     }
 
-    void GameTimer::Stop()
+    void GameTimer::Reset()
     {
         isRunning = false;
+        accumulated = Clock::duration::zero();
     }
 
-    void GameTimer::Reset()
+    GameTimer::Clock::duration GameTimer::GetElapsed() const
+    {
+        Clock::duration elapsed = accumulated;
+        if (isRunning)
+        {
+            elapsed += Clock::now() - startedAt;
+        }
+        return std::min(elapsed, timeLimit);
+    }
+
+    long long GameTimer::GetElapsedMilliseconds() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(GetElapsed()).count();
+    }
+
+    long long GameTimer::GetRemainingMilliseconds() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(timeLimit - GetElapsed()).count();
+    }
+
+    int GameTimer::GetTimeLeft() const
     {
-        Stop();
-        timeLeft = initialTime;
+        // Округляем вверх: "00:00" показывается только когда время действительно вышло
+        return static_cast<int>((GetRemainingMilliseconds() + 999) / 1000);
     }
 
     std::string GameTimer::FormatTime(int seconds)
@@ -43,4 +71,12 @@ namespace MineSweeper {
             << std::setw(2) << std::setfill('0') << secs;
         return oss.str();
     }
+
+    std::string GameTimer::FormatMilliseconds(long long milliseconds)
+    {
+        std::ostringstream oss;
+        oss << FormatTime(static_cast<int>(milliseconds / 1000)) << "."
+            << std::setw(3) << std::setfill('0') << milliseconds % 1000;
+        return oss.str();
+    }
 }
\ No newline at end of file
@@ -1,17 +1,24 @@
 ﻿#pragma once
 
 #include <string>
+#include <chrono>
 
 namespace MineSweeper {
 
     /// <summary>
-    /// Класс для управления игровым таймером
+    /// Класс для управления игровым таймером.
+    /// Время считается по отметкам std::chrono::steady_clock, поэтому не зависит от того,
+    /// как часто и насколько вовремя интерфейс обновляет отображение
     /// </summary>
     class GameTimer
     {
+    public:
+        using Clock = std::chrono::steady_clock;
+
     private:
-        int timeLeft;
-        int initialTime;
+        Clock::duration timeLimit;    // Лимит времени партии
+        Clock::duration accumulated;  // Время, набранное до последнего запуска
+        Clock::time_point startedAt;  // Момент последнего запуска
         bool isRunning;
 
     public:
@@ -26,19 +33,20 @@ namespace MineSweeper {
         ~GameTimer() = default;
 
         /// <summary>
-        /// Обновляет состояние таймера (вызывается каждый кадр/тик)
+        /// Запускает или продолжает таймер
         /// </summary>
-        void Update();
+        void Start();
 
         /// <summary>
-        /// Запускает таймер
+        /// Останавливает таймер; прошедшее время сохраняется
         /// </summary>
-        void Start();
+        void Stop();
 
         /// <summary>
-        /// Останавливает таймер
+        /// Пауза и продолжение (синонимы Stop и Start)
         /// </summary>
-        void Stop();
+        void Pause() { Stop(); }
+        void Resume() { Start(); }
 
         /// <summary>
         /// Сбрасывает таймер
@@ -46,14 +54,24 @@ namespace MineSweeper {
         void Reset();
 
         /// <summary>
-        /// Возвращает оставшееся время
+        /// Прошедшее время партии в миллисекундах (не больше лимита)
+        /// </summary>
+        long long GetElapsedMilliseconds() const;
+
+        /// <summary>
+        /// Оставшееся время в миллисекундах
         /// </summary>
-        int GetTimeLeft() const { return timeLeft; }
+        long long GetRemainingMilliseconds() const;
+
+        /// <summary>
+        /// Возвращает оставшееся время в целых секундах (с округлением вверх)
+        /// </summary>
+        int GetTimeLeft() const;
 
         /// <summary>
         /// Проверяет, истекло ли время
         /// </summary>
-        bool IsTimeUp() const { return timeLeft <= 0; }
+        bool IsTimeUp() const { return GetRemainingMilliseconds() <= 0; }
 
         /// <summary>
         /// Проверяет, запущен ли таймер
@@ -64,5 +82,16 @@ namespace MineSweeper {
         /// Форматирует время в строку MM:SS
         /// </summary>
         static std::string FormatTime(int seconds);
+
+        /// <summary>
+        /// Форматирует время в строку MM:SS.mmm
+        /// </summary>
+        static std::string FormatMilliseconds(long long milliseconds);
+
+        // Снимок партии сохраняет и восстанавливает прошедшее время
+        friend class GameSnapshot;
+
+    private:
+        Clock::duration GetElapsed() const;
     };
 }
\ No newline at end of file
@@ -13,8 +13,8 @@ namespace MineSweeper {
         return info;
     }
 
-    bool InputHandler::IsValidCoordinates(int row, int col, int gridSize)
+    bool InputHandler::IsValidCoordinates(int row, int col, int rows, int cols)
     {
-        return row >= 0 && row < gridSize && col >= 0 && col < gridSize;
+        return row >= 0 && row < rows && col >= 0 && col < cols;
     }
 }
\ No newline at end of file
@@ -58,6 +58,6 @@ namespace MineSweeper {
         /// <summary>
         /// Проверяет валидность координат
         /// </summary>
-        static bool IsValidCoordinates(int row, int col, int gridSize);
+        static bool IsValidCoordinates(int row, int col, int rows, int cols);
     };
 }
\ No newline at end of file
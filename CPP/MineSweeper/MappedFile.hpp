@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Файл, отображённый в память только для чтения.
+    /// Загрузка снимков и журнала статистики читает файл одним отображением без копирования
+    /// </summary>
+    class MappedFile
+    {
+    public:
+        /// <summary>
+        /// Открывает и отображает файл; пустой или недоступный файл - runtime_error
+        /// </summary>
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const unsigned char* GetData() const { return static_cast<const unsigned char*>(view); }
+        size_t GetSize() const { return size; }
+
+    private:
+#ifdef _WIN32
+        void* file;     // HANDLE
+        void* mapping;  // HANDLE
+#else
+        int descriptor;
+#endif
+        void* view;
+        size_t size;
+    };
+}
\ No newline at end of file
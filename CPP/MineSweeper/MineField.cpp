@@ -1,67 +1,109 @@
 ﻿#include "MineField.hpp"
+#include "BoardGenerator.hpp"
 #include <random>
 #include <stdexcept>
 
 namespace MineSweeper {
 
     MineField::MineField(int size, int mines)
-        : BaseField(size, mines), random(std::random_device{}()), fieldName("Default Field")
+        : BaseField(size, mines), random(std::random_device{}()), fieldName("Default Field"),
+        generationMode(GenerationMode::Immediate), minesPlaced(false), openedSafeCount(0), journalPosition(0)
     {
-        if (minesCount >= gridSize * gridSize) {
-            throw std::invalid_argument("Too many mines for the grid size");
-        }
+        ValidateSize();
         Initialize();
     }
 
     MineField::MineField(int size, int mines, const std::string& name)
-        : BaseField(size, mines), random(std::random_device{}()), fieldName(name)
+        : BaseField(size, mines), random(std::random_device{}()), fieldName(name),
+        generationMode(GenerationMode::Immediate), minesPlaced(false), openedSafeCount(0), journalPosition(0)
     {
-        if (minesCount >= gridSize * gridSize) {
-            throw std::invalid_argument("Too many mines for the grid size");
-        }
+        ValidateSize();
+        Initialize();
+    }
+
+    MineField::MineField(int size, int mines, SeedType seed)
+        : BaseField(size, mines), random(seed), fieldName("Seeded Field"),
+        generationMode(GenerationMode::Immediate), minesPlaced(false), openedSafeCount(0), journalPosition(0)
+    {
+        ValidateSize();
+        Initialize();
+    }
+
+    MineField::MineField(FieldSize size, int mines, GenerationMode mode)
+        : BaseField(size.rows, size.cols, mines), random(std::random_device{}()), fieldName("Default Field"),
+        generationMode(mode), minesPlaced(false), openedSafeCount(0), journalPosition(0)
+    {
+        ValidateSize();
+        Initialize();
+    }
+
+    MineField::MineField(FieldSize size, int mines, SeedType seed, GenerationMode mode)
+        : BaseField(size.rows, size.cols, mines), random(seed), fieldName("Seeded Field"),
+        generationMode(mode), minesPlaced(false), openedSafeCount(0), journalPosition(0)
+    {
+        ValidateSize();
         Initialize();
     }
 
     MineField::MineField(const MineField& other)
-        : BaseField(other.gridSize, other.minesCount),
+        : BaseField(other.rows, other.cols, other.minesCount),
         mines(other.mines),
         opened(other.opened),
         flagged(other.flagged),
         random(std::random_device{}()),
-        fieldName(other.fieldName + " (Copy)")
+        fieldName(other.fieldName + " (Copy)"),
+        generationMode(other.generationMode),
+        minesPlaced(other.minesPlaced),
+        openedSafeCount(other.openedSafeCount),
+        journal(other.journal),
+        journalCells(other.journalCells),
+        journalPosition(other.journalPosition),
+        generationThreads(other.generationThreads)
     {
         // Копируем состояние
     }
 
     MineField::MineField(const BaseField& base, const std::string& name)
-        : BaseField(base), random(std::random_device{}()), fieldName(name.empty() ? "Derived Field" : name)
+        : BaseField(base), random(std::random_device{}()), fieldName(name.empty() ? "Derived Field" : name),
+        generationMode(GenerationMode::Immediate), minesPlaced(false), openedSafeCount(0), journalPosition(0)
     {
+        ValidateSize();
         Initialize();
     }
 
     MineField& MineField::operator=(const MineField& other)
     {
         if (this != &other) {
-            gridSize = other.gridSize;
+            rows = other.rows;
+            cols = other.cols;
             minesCount = other.minesCount;
             mines = other.mines;
             opened = other.opened;
             flagged = other.flagged;
             fieldName = other.fieldName + " (Assigned)";
+            generationMode = other.generationMode;
+            minesPlaced = other.minesPlaced;
+            openedSafeCount = other.openedSafeCount;
+            journal = other.journal;
+            journalCells = other.journalCells;
+            journalPosition = other.journalPosition;
+            generationThreads = other.generationThreads;
+            pendingMines.reset();
         }
         return *this;
     }
 
     bool MineField::operator==(const MineField& other) const
     {
-        return gridSize == other.gridSize &&
+        return rows == other.rows &&
+            cols == other.cols &&
             minesCount == other.minesCount &&
             fieldName == other.fieldName;
     }
 
     std::vector<bool>& MineField::operator[](int row)
     {
-        if (row < 0 || row >= gridSize) {
+        if (row < 0 || row >= rows) {
             throw std::out_of_range("Row index out of range");
         }
         return mines[row];
@@ -69,7 +111,7 @@ namespace MineSweeper {
 
     const std::vector<bool>& MineField::operator[](int row) const
     {
-        if (row < 0 || row >= gridSize) {
+        if (row < 0 || row >= rows) {
             throw std::out_of_range("Row index out of range");
         }
         return mines[row];
@@ -79,7 +121,7 @@ namespace MineSweeper {
     {
         std::ostringstream oss;
         oss << "MineField: " << fieldName
-            << ", Size: " << gridSize << "x" << gridSize
+            << ", Size: " << rows << "x" << cols
             << ", Mines: " << minesCount
             << ", Opened cells: " << [this]() {
             int count = 0;
@@ -96,22 +138,37 @@ namespace MineSweeper {
         fieldName = name;
     }
 
+    void MineField::SetGenerationMode(GenerationMode mode)
+    {
+        generationMode = mode;
+        Initialize();
+    }
+
     // Дружественная функция для обмена
     void SwapFields(MineField& first, MineField& second)
     {
         using std::swap;
-        swap(first.gridSize, second.gridSize);
+        swap(first.rows, second.rows);
+        swap(first.cols, second.cols);
         swap(first.minesCount, second.minesCount);
         swap(first.mines, second.mines);
         swap(first.opened, second.opened);
         swap(first.flagged, second.flagged);
         swap(first.fieldName, second.fieldName);
+        swap(first.generationMode, second.generationMode);
+        swap(first.minesPlaced, second.minesPlaced);
+        swap(first.openedSafeCount, second.openedSafeCount);
+        swap(first.journal, second.journal);
+        swap(first.journalCells, second.journalCells);
+        swap(first.journalPosition, second.journalPosition);
+        swap(first.pendingMines, second.pendingMines);
+        swap(first.generationThreads, second.generationThreads);
     }
 
     // Дружественная функция для BaseField
     std::ostream& operator<<(std::ostream& os, const BaseField& field)
     {
-        os << "BaseField: Size=" << field.GetGridSize()
+        os << "BaseField: Size=" << field.GetRows() << "x" << field.GetCols()
             << ", Mines=" << field.GetMinesCount();
         return os;
     }
@@ -120,10 +177,21 @@ namespace MineSweeper {
     void MineField::Initialize()
     {
         Clear();
-        mines = std::vector<std::vector<bool>>(gridSize, std::vector<bool>(gridSize, false));
-        opened = std::vector<std::vector<bool>>(gridSize, std::vector<bool>(gridSize, false));
-        flagged = std::vector<std::vector<bool>>(gridSize, std::vector<bool>(gridSize, false));
-        PlaceMines();
+        lastOpened.clear();
+        ClearJournal();
+        pendingMines.reset();
+        openedSafeCount = 0;
+        mines = std::vector<std::vector<bool>>(rows, std::vector<bool>(cols, false));
+        opened = std::vector<std::vector<bool>>(rows, std::vector<bool>(cols, false));
+        flagged = std::vector<std::vector<bool>>(rows, std::vector<bool>(cols, false));
+
+        // В отложенных режимах мины появятся при первом OpenCell
+        minesPlaced = false;
+        if (generationMode == GenerationMode::Immediate)
+        {
+            PlaceMines();
+            minesPlaced = true;
+        }
     }
 
     void MineField::Clear()
@@ -131,38 +199,115 @@ namespace MineSweeper {
         // Векторы очищаются автоматически при присваивании
     }
 
-    void MineField::PlaceMines()
+    void MineField::PlaceMines(const std::vector<int>& excluded)
     {
-        std::uniform_int_distribution<int> dist(0, gridSize - 1);
-        int placed = 0;
-
-        while (placed < minesCount)
+        for (int cell : BoardGenerator::SampleMineCells(rows * cols, minesCount, excluded, random))
         {
-            int r = dist(random);
-            int c = dist(random);
+            mines[cell / cols][cell % cols] = true;
+        }
+    }
 
-            if (!mines[r][c])
+    void MineField::PlaceMinesAround(int row, int col)
+    {
+        if (generationMode == GenerationMode::NoGuess)
+        {
+            // Готовый фоновый поиск для этой клетки, иначе синхронная генерация
+            BoardGenerator::Layout layout = pendingMines && pendingMines->GetRow() == row && pendingMines->GetCol() == col
+                ? pendingMines->TakeLayout()
+                : BoardGenerator::GenerateNoGuess(rows, cols, minesCount, row, col, random,
+                    BoardGenerator::DEFAULT_MAX_ATTEMPTS, generationThreads);
+            pendingMines.reset();
+
+            for (int cell = 0; cell < rows * cols; cell++)
             {
-                mines[r][c] = true;
-                placed++;
+                mines[cell / cols][cell % cols] = layout[cell] != 0;
             }
         }
+        else
+        {
+            PlaceMines(BoardGenerator::GetSafeZone(rows, cols, minesCount, row, col));
+        }
+        minesPlaced = true;
+    }
+
+    bool MineField::BeginMinePlacement(int row, int col)
+    {
+        if (minesPlaced || generationMode != GenerationMode::NoGuess || !IsValidCoordinate(row, col))
+            return false;
+
+        pendingMines = std::make_unique<NoGuessGeneration>(rows, cols, minesCount, row, col, random());
+        return true;
     }
 
     bool MineField::OpenCell(int row, int col)
     {
+        lastOpened.clear();
+
         if (!IsValidCoordinate(row, col))
             return false;
 
         if (opened[row][col] || flagged[row][col])
             return false;
 
+        if (!minesPlaced)
+        {
+            PlaceMinesAround(row, col);
+        }
+
+        bool safe = RevealCell(row, col);
+        RecordOperation(Operation::Type::Open, lastOpened.data(), static_cast<int>(lastOpened.size()));
+        return safe;
+    }
+
+    bool MineField::Chord(int row, int col)
+    {
+        lastOpened.clear();
+
+        if (!IsValidCoordinate(row, col) || !opened[row][col] || mines[row][col])
+            return true;
+
+        int minesAround = CountMinesAround(row, col);
+        int flagsAround = 0;
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                if (IsValidCoordinate(row + dr, col + dc) && flagged[row + dr][col + dc])
+                    flagsAround++;
+            }
+        }
+
+        if (minesAround == 0 || flagsAround != minesAround)
+            return true;
+
+        // Все соседи открываются в один пакет lastOpened - форма получает одну разницу
+        bool safe = true;
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                int nr = row + dr;
+                int nc = col + dc;
+                if (IsValidCoordinate(nr, nc) && !opened[nr][nc] && !flagged[nr][nc])
+                {
+                    safe = RevealCell(nr, nc) && safe;
+                }
+            }
+        }
+        RecordOperation(Operation::Type::Open, lastOpened.data(), static_cast<int>(lastOpened.size()));
+        return safe;
+    }
+
+    bool MineField::RevealCell(int row, int col)
+    {
         opened[row][col] = true;
+        lastOpened.push_back(row * cols + col);
 
         if (mines[row][col])
         {
             return false; // Игрок наступил на мину
         }
+        openedSafeCount++;
 
         int minesAround = CountMinesAround(row, col);
         if (minesAround == 0)
@@ -175,25 +320,37 @@ namespace MineSweeper {
 
     void MineField::OpenEmptyCells(int row, int col)
     {
-        for (int dr = -1; dr <= 1; dr++)
+        // Явный стек вместо рекурсии: на больших полях каскад не упирается в стек вызовов
+        floodStack.clear();
+        floodStack.push_back(row * cols + col);
+
+        while (!floodStack.empty())
         {
-            for (int dc = -1; dc <= 1; dc++)
+            int cell = floodStack.back();
+            floodStack.pop_back();
+            int r = cell / cols;
+            int c = cell % cols;
+
+            for (int dr = -1; dr <= 1; dr++)
             {
-                if (dr != 0 || dc != 0)
+                for (int dc = -1; dc <= 1; dc++)
                 {
-                    int newRow = row + dr;
-                    int newCol = col + dc;
+                    int newRow = r + dr;
+                    int newCol = c + dc;
 
-                    if (IsValidCoordinate(newRow, newCol) &&
+                    if ((dr != 0 || dc != 0) &&
+                        IsValidCoordinate(newRow, newCol) &&
                         !opened[newRow][newCol] &&
                         !flagged[newRow][newCol] &&
                         !mines[newRow][newCol])
                     {
                         opened[newRow][newCol] = true;
+                        lastOpened.push_back(newRow * cols + newCol);
+                        openedSafeCount++;
 
                         if (CountMinesAround(newRow, newCol) == 0)
                         {
-                            OpenEmptyCells(newRow, newCol);
+                            floodStack.push_back(newRow * cols + newCol);
                         }
                     }
                 }
@@ -206,7 +363,88 @@ namespace MineSweeper {
         if (IsValidCoordinate(row, col) && !opened[row][col])
         {
             flagged[row][col] = !flagged[row][col];
+
+            int cell = row * cols + col;
+            RecordOperation(Operation::Type::Flag, &cell, 1);
+        }
+    }
+
+    bool MineField::Undo()
+    {
+        lastOpened.clear();
+        if (!CanUndo())
+            return false;
+
+        const Operation& operation = journal[--journalPosition];
+        for (int i = operation.first; i < operation.first + operation.count; i++)
+        {
+            int r = journalCells[i] / cols;
+            int c = journalCells[i] % cols;
+            if (operation.type == Operation::Type::Flag)
+            {
+                flagged[r][c] = !flagged[r][c];
+            }
+            else
+            {
+                opened[r][c] = false;
+                if (!mines[r][c]) openedSafeCount--;
+            }
+        }
+        return true;
+    }
+
+    bool MineField::Redo()
+    {
+        lastOpened.clear();
+        if (!CanRedo())
+            return false;
+
+        // Ход повторяется по записанным клеткам, без повторного каскада
+        const Operation& operation = journal[journalPosition++];
+        for (int i = operation.first; i < operation.first + operation.count; i++)
+        {
+            int r = journalCells[i] / cols;
+            int c = journalCells[i] % cols;
+            if (operation.type == Operation::Type::Flag)
+            {
+                flagged[r][c] = !flagged[r][c];
+            }
+            else
+            {
+                opened[r][c] = true;
+                if (!mines[r][c]) openedSafeCount++;
+                lastOpened.push_back(journalCells[i]);
+            }
         }
+        return true;
+    }
+
+    void MineField::RecordOperation(Operation::Type type, const int* cells, int count)
+    {
+        if (count == 0)
+            return;
+
+        // Новый ход отбрасывает отменённые ходы
+        if (journalPosition < journal.size())
+        {
+            journalCells.resize(journal[journalPosition].first);
+            journal.resize(journalPosition);
+        }
+
+        Operation operation;
+        operation.type = type;
+        operation.first = static_cast<int>(journalCells.size());
+        operation.count = count;
+        journal.push_back(operation);
+        journalCells.insert(journalCells.end(), cells, cells + count);
+        journalPosition = journal.size();
+    }
+
+    void MineField::ClearJournal()
+    {
+        journal.clear();
+        journalCells.clear();
+        journalPosition = 0;
     }
 
     int MineField::CountMinesAround(int row, int col) const
@@ -232,15 +470,7 @@ namespace MineSweeper {
 
     bool MineField::CheckWin() const
     {
-        for (int r = 0; r < gridSize; r++)
-        {
-            for (int c = 0; c < gridSize; c++)
-            {
-                if (!mines[r][c] && !opened[r][c])
-                    return false;
-            }
-        }
-        return true;
+        return openedSafeCount == rows * cols - minesCount;
     }
 
     MineField::CellState MineField::GetCellState(int row, int col) const
@@ -255,6 +485,19 @@ namespace MineSweeper {
 
     bool MineField::IsValidCoordinate(int row, int col) const
     {
-        return row >= 0 && row < gridSize && col >= 0 && col < gridSize;
+        return row >= 0 && row < rows && col >= 0 && col < cols;
+    }
+
+    void MineField::ValidateSize() const
+    {
+        if (rows <= 0 || cols <= 0) {
+            throw std::invalid_argument("Field dimensions must be positive");
+        }
+        if (static_cast<long long>(rows) * cols > MAX_CELLS) {
+            throw std::invalid_argument("Field is too large");
+        }
+        if (minesCount < 0 || minesCount >= rows * cols) {
+            throw std::invalid_argument("Too many mines for the grid size");
+        }
     }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <functional>
+#include "BoardGenerator.hpp"
 
 namespace MineSweeper {
 
@@ -19,34 +20,90 @@ namespace MineSweeper {
     class BaseField
     {
     protected:
-        int gridSize;
+        int rows;
+        int cols;
         int minesCount;
 
     public:
-        BaseField(int size, int mines) : gridSize(size), minesCount(mines) {}
+        BaseField(int size, int mines) : BaseField(size, size, mines) {}
+        BaseField(int rows, int cols, int mines) : rows(rows), cols(cols), minesCount(mines) {}
         virtual ~BaseField() = default;
 
         virtual void Initialize() = 0;
         virtual void Clear() = 0;
 
-        int GetGridSize() const { return gridSize; }
+        int GetRows() const { return rows; }
+        int GetCols() const { return cols; }
+        int GetCellsCount() const { return rows * cols; }
         int GetMinesCount() const { return minesCount; }
 
         // Дружественная функция для вывода информации
         friend std::ostream& operator<<(std::ostream& os, const BaseField& field);
     };
 
+    /// <summary>
+    /// Размеры прямоугольного поля. Отдельный тип, чтобы вызов (rows, cols, mines)
+    /// нельзя было спутать с (size, mines, seed)
+    /// </summary>
+    struct FieldSize
+    {
+        int rows;
+        int cols;
+    };
+
     /// <summary>
     /// Класс для управления игровым полем с минами
     /// </summary>
     class MineField : public BaseField
     {
+    public:
+        using SeedType = std::mt19937::result_type;
+
+        // Предел размера поля: плоские индексы клеток хранятся в int
+        static const int MAX_CELLS = 16 * 1024 * 1024;
+
+        /// <summary>
+        /// Режим генерации мин
+        /// </summary>
+        enum class GenerationMode
+        {
+            Immediate = 0,       // Мины расставляются сразу при инициализации
+            FirstClickSafe = 1,  // Мины расставляются при первом ходе, вне окрестности 3x3
+            NoGuess = 2          // Как FirstClickSafe, но поле проходится без угадывания
+        };
+
     private:
+        /// <summary>
+        /// Запись журнала ходов: клетки хода лежат в journalCells[first, first + count)
+        /// </summary>
+        struct Operation
+        {
+            enum class Type : char
+            {
+                Open = 0,   // Пакет открытых клеток (OpenCell или Chord)
+                Flag = 1    // Переключение флага одной клетки
+            };
+
+            Type type;
+            int first;
+            int count;
+        };
+
         std::vector<std::vector<bool>> mines;         // Расположение мин
         std::vector<std::vector<bool>> opened;        // Открытые клетки
         std::vector<std::vector<bool>> flagged;       // Клетки с флагами
         std::mt19937 random;         // Генератор случайных чисел
         std::string fieldName;       // Имя поля
+        GenerationMode generationMode;  // Режим генерации
+        bool minesPlaced;            // Расставлены ли мины
+        int openedSafeCount;         // Открытые клетки без мин (проверка победы за O(1))
+        std::vector<int> lastOpened; // Клетки, открытые последним ходом (row * cols + col)
+        std::vector<int> floodStack; // Стек каскадного открытия пустых клеток
+        std::vector<Operation> journal; // Журнал ходов для отмены и повтора
+        std::vector<int> journalCells;  // Клетки, изменённые ходами журнала
+        size_t journalPosition;         // Число применённых ходов; дальше - ходы для повтора
+        std::unique_ptr<NoGuessGeneration> pendingMines;  // Фоновый поиск поля для первого хода
+        unsigned generationThreads = 0;  // Потоки синхронного поиска поля без угадывания, 0 - по числу ядер
 
     public:
         /// <summary>
@@ -59,6 +116,22 @@ namespace MineSweeper {
         /// </summary>
         MineField(int size, int mines, const std::string& name);
 
+        /// <summary>
+        /// Конструктор квадратного поля с фиксированным зерном генератора (воспроизводимая расстановка)
+        /// </summary>
+        MineField(int size, int mines, SeedType seed);
+
+        /// <summary>
+        /// Конструктор прямоугольного поля с заданным режимом генерации
+        /// </summary>
+        MineField(FieldSize size, int mines, GenerationMode mode = GenerationMode::Immediate);
+
+        /// <summary>
+        /// Конструктор прямоугольного поля с фиксированным зерном генератора
+        /// </summary>
+        MineField(FieldSize size, int mines, SeedType seed,
+            GenerationMode mode = GenerationMode::Immediate);
+
         /// <summary>
         /// Конструктор копирования
         /// </summary>
@@ -104,10 +177,58 @@ namespace MineSweeper {
         /// </summary>
         void SetName(const std::string& name);
 
+        /// <summary>
+        /// Переинициализирует генератор случайных чисел заданным зерном
+        /// </summary>
+        void SetSeed(SeedType seed) { random.seed(seed); }
+
+        /// <summary>
+        /// Устанавливает режим генерации и пересоздаёт поле
+        /// </summary>
+        void SetGenerationMode(GenerationMode mode);
+        GenerationMode GetGenerationMode() const { return generationMode; }
+
+        /// <summary>
+        /// Число потоков синхронного поиска поля без угадывания (0 - по числу ядер).
+        /// Пакетные прогоны, которые сами занимают все ядра, ставят 1
+        /// </summary>
+        void SetGenerationThreads(unsigned threads) { generationThreads = threads; }
+
+        /// <summary>
+        /// Расставлены ли мины (в отложенных режимах - после первого хода)
+        /// </summary>
+        bool AreMinesPlaced() const { return minesPlaced; }
+
+        /// <summary>
+        /// Запускает фоновый поиск поля без угадывания для первого хода в (row, col).
+        /// Пока IsGeneratingMines() возвращает true, интерфейс остаётся отзывчивым;
+        /// затем OpenCell(row, col) берёт готовую расстановку без ожидания.
+        /// Возвращает false, если поиск не нужен: мины уже стоят или режим не NoGuess
+        /// </summary>
+        bool BeginMinePlacement(int row, int col);
+
+        /// <summary>
+        /// Идёт ли фоновый поиск расстановки
+        /// </summary>
+        bool IsGeneratingMines() const { return pendingMines && !pendingMines->IsReady(); }
+
+        /// <summary>
+        /// Доля израсходованного лимита фонового поиска, от 0 до 1
+        /// </summary>
+        double GetGenerationProgress() const { return pendingMines ? pendingMines->GetProgress() : 1.0; }
+
         // Остальные методы остаются без изменений
         void Initialize() override;
         void Clear() override;
         bool OpenCell(int row, int col);
+
+        /// <summary>
+        /// Аккорд: если вокруг открытой клетки флагов столько же, сколько мин,
+        /// открывает всех её соседей без флагов одним пакетом (см. GetLastOpenedCells).
+        /// Возвращает false, только если открылась мина
+        /// </summary>
+        bool Chord(int row, int col);
+
         void ToggleFlag(int row, int col);
         int CountMinesAround(int row, int col) const;
         bool CheckWin() const;
@@ -115,6 +236,25 @@ namespace MineSweeper {
         bool IsOpened(int row, int col) const { return opened[row][col]; }
         bool IsFlagged(int row, int col) const { return flagged[row][col]; }
 
+        /// <summary>
+        /// Клетки, открытые последним вызовом OpenCell или Chord (индексы row * cols + col)
+        /// </summary>
+        const std::vector<int>& GetLastOpenedCells() const { return lastOpened; }
+
+        /// <summary>
+        /// Отменяет последний ход. Стоимость и память пропорциональны числу клеток хода.
+        /// Мины, расставленные первым ходом, остаются на месте
+        /// </summary>
+        bool Undo();
+
+        /// <summary>
+        /// Повторяет отменённый ход; открытые клетки попадают в GetLastOpenedCells
+        /// </summary>
+        bool Redo();
+
+        bool CanUndo() const { return journalPosition > 0; }
+        bool CanRedo() const { return journalPosition < journal.size(); }
+
         struct CellState {
             bool isMine;
             bool isOpened;
@@ -127,10 +267,21 @@ namespace MineSweeper {
         // Дружественная функция для обмена полями
         friend void SwapFields(MineField& first, MineField& second);
 
+        // Снимок партии читает и восстанавливает плоскости поля напрямую
+        friend class GameSnapshot;
+
+        // Замер вызывает PlaceMines без пересоздания плоскостей
+        friend class Benchmark;
+
     private:
-        void PlaceMines();
+        void PlaceMines(const std::vector<int>& excluded = {});
+        void PlaceMinesAround(int row, int col);
+        bool RevealCell(int row, int col);
         void OpenEmptyCells(int row, int col);
         bool IsValidCoordinate(int row, int col) const;
+        void ValidateSize() const;
+        void RecordOperation(Operation::Type type, const int* cells, int count);
+        void ClearJournal();
     };
 
     // Дружественная функция для BaseField
@@ -0,0 +1,687 @@
+﻿#include "MineSolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace MineSweeper {
+
+    namespace {
+        // Свёртка распределений числа мин двух независимых частей поля
+        std::vector<double> Convolve(const std::vector<double>& a, const std::vector<double>& b)
+        {
+            std::vector<double> result(a.size() + b.size() - 1, 0.0);
+            for (size_t i = 0; i < a.size(); i++)
+            {
+                if (a[i] == 0.0) continue;
+                for (size_t j = 0; j < b.size(); j++)
+                {
+                    result[i + j] += a[i] * b[j];
+                }
+            }
+            return result;
+        }
+
+        double LogBinomial(int n, int k)
+        {
+            return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+        }
+    }
+
+    MineSolver::MineSolver(int rows, int cols, int totalMines)
+        : rows(rows), cols(cols), totalMines(totalMines),
+        unknownCount(rows * cols), knownMines(0),
+        numbers(static_cast<size_t>(rows) * cols, -1),
+        knowledge(static_cast<size_t>(rows) * cols, static_cast<char>(Knowledge::Unknown)),
+        queued(static_cast<size_t>(rows) * cols, 0),
+        componentOf(static_cast<size_t>(rows) * cols, -1),
+        constraintOf(static_cast<size_t>(rows) * cols, -1),
+        interiorProbability(rows * cols > 0 ? static_cast<double>(totalMines) / (rows * cols) : 0.0)
+    {
+    }
+
+    void MineSolver::Reveal(int row, int col, int minesAround)
+    {
+        int cell = row * cols + col;
+        Knowledge state = static_cast<Knowledge>(knowledge[cell]);
+        if (state == Knowledge::Revealed || state == Knowledge::Mine)
+            return;
+
+        if (state == Knowledge::Unknown)
+        {
+            unknownCount--;
+        }
+        knowledge[cell] = static_cast<char>(Knowledge::Revealed);
+        numbers[cell] = static_cast<signed char>(minesAround);
+
+        if (minesAround > 0)
+        {
+            constraints.push_back(cell);
+        }
+        Queue(cell);
+        // У соседей сократилось множество неизвестных клеток
+        QueueRevealedNeighbours(cell);
+    }
+
+    void MineSolver::Apply(const MineField& field, const std::vector<int>& openedCells)
+    {
+        for (int cell : openedCells)
+        {
+            int row = cell / cols;
+            int col = cell % cols;
+            if (!field.IsMine(row, col))
+            {
+                Reveal(row, col, field.CountMinesAround(row, col));
+            }
+        }
+    }
+
+    void MineSolver::Sync(const MineField& field)
+    {
+        for (int row = 0; row < rows; row++)
+        {
+            for (int col = 0; col < cols; col++)
+            {
+                if (field.IsOpened(row, col) && !field.IsMine(row, col))
+                {
+                    Reveal(row, col, field.CountMinesAround(row, col));
+                }
+            }
+        }
+    }
+
+    void MineSolver::Solve()
+    {
+        // Перебор может найти новые клетки, которые снова дают работу правилам
+        do {
+            Propagate();
+        } while (Enumerate());
+
+        safeCells.erase(std::remove_if(safeCells.begin(), safeCells.end(),
+            [this](int cell) { return knowledge[cell] != static_cast<char>(Knowledge::Safe); }),
+            safeCells.end());
+    }
+
+    const std::vector<int>& MineSolver::FindSafeCells()
+    {
+        Propagate();
+
+        safeCells.erase(std::remove_if(safeCells.begin(), safeCells.end(),
+            [this](int cell) { return knowledge[cell] != static_cast<char>(Knowledge::Safe); }),
+            safeCells.end());
+        if (safeCells.empty())
+        {
+            Solve();
+        }
+        return safeCells;
+    }
+
+    double MineSolver::GetMineProbability(int row, int col) const
+    {
+        int cell = row * cols + col;
+        switch (static_cast<Knowledge>(knowledge[cell]))
+        {
+        case Knowledge::Mine:
+            return 1.0;
+        case Knowledge::Revealed:
+        case Knowledge::Safe:
+            return 0.0;
+        default:
+            break;
+        }
+
+        auto it = frontierProbabilities.find(cell);
+        return it != frontierProbabilities.end() ? it->second : interiorProbability;
+    }
+
+    bool MineSolver::GetHint(Hint& hint) const
+    {
+        for (int cell : safeCells)
+        {
+            if (knowledge[cell] == static_cast<char>(Knowledge::Safe))
+            {
+                hint = { cell / cols, cell % cols, true, 0.0 };
+                return true;
+            }
+        }
+
+        int best = -1;
+        double bestProbability = 2.0;
+        for (const auto& entry : frontierProbabilities)
+        {
+            if (entry.second < bestProbability ||
+                (entry.second == bestProbability && entry.first < best))
+            {
+                best = entry.first;
+                bestProbability = entry.second;
+            }
+        }
+
+        // Внутренняя клетка, если она не хуже границы: сначала углы, у них меньше соседей
+        if (interiorProbability < bestProbability || best < 0)
+        {
+            const int corners[4] = { 0, cols - 1, (rows - 1) * cols, rows * cols - 1 };
+            int interior = -1;
+            for (int corner : corners)
+            {
+                if (knowledge[corner] == static_cast<char>(Knowledge::Unknown) &&
+                    frontierProbabilities.find(corner) == frontierProbabilities.end())
+                {
+                    interior = corner;
+                    break;
+                }
+            }
+            for (int cell = 0; interior < 0 && cell < rows * cols; cell++)
+            {
+                if (knowledge[cell] == static_cast<char>(Knowledge::Unknown) &&
+                    frontierProbabilities.find(cell) == frontierProbabilities.end())
+                {
+                    interior = cell;
+                }
+            }
+            if (interior >= 0)
+            {
+                best = interior;
+                bestProbability = interiorProbability;
+            }
+        }
+
+        if (best < 0)
+            return false;
+
+        hint = { best / cols, best % cols, bestProbability == 0.0, bestProbability };
+        return true;
+    }
+
+    int MineSolver::GetNeighbours(int cell, int* out) const
+    {
+        int count = 0;
+        int row = cell / cols;
+        int col = cell % cols;
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                int r = row + dr;
+                int c = col + dc;
+                if ((dr != 0 || dc != 0) && r >= 0 && r < rows && c >= 0 && c < cols)
+                {
+                    out[count++] = r * cols + c;
+                }
+            }
+        }
+        return count;
+    }
+
+    bool MineSolver::BuildConstraint(int cell, Constraint& constraint) const
+    {
+        if (knowledge[cell] != static_cast<char>(Knowledge::Revealed))
+            return false;
+
+        int neighbours[8];
+        int count = GetNeighbours(cell, neighbours);
+
+        constraint.count = 0;
+        constraint.need = numbers[cell];
+        for (int i = 0; i < count; i++)
+        {
+            Knowledge state = static_cast<Knowledge>(knowledge[neighbours[i]]);
+            if (state == Knowledge::Unknown)
+            {
+                constraint.cells[constraint.count++] = neighbours[i];
+            }
+            else if (state == Knowledge::Mine)
+            {
+                constraint.need--;
+            }
+        }
+        return true;
+    }
+
+    void MineSolver::Queue(int cell)
+    {
+        if (!queued[cell])
+        {
+            queued[cell] = 1;
+            work.push_back(cell);
+        }
+    }
+
+    void MineSolver::QueueRevealedNeighbours(int cell)
+    {
+        int neighbours[8];
+        int count = GetNeighbours(cell, neighbours);
+        for (int i = 0; i < count; i++)
+        {
+            if (knowledge[neighbours[i]] == static_cast<char>(Knowledge::Revealed) && numbers[neighbours[i]] > 0)
+            {
+                Queue(neighbours[i]);
+            }
+        }
+    }
+
+    void MineSolver::MarkSafe(int cell)
+    {
+        if (knowledge[cell] != static_cast<char>(Knowledge::Unknown))
+            return;
+
+        knowledge[cell] = static_cast<char>(Knowledge::Safe);
+        unknownCount--;
+        safeCells.push_back(cell);
+        QueueRevealedNeighbours(cell);
+    }
+
+    void MineSolver::MarkMine(int cell)
+    {
+        if (knowledge[cell] != static_cast<char>(Knowledge::Unknown))
+            return;
+
+        knowledge[cell] = static_cast<char>(Knowledge::Mine);
+        unknownCount--;
+        knownMines++;
+        mineCells.push_back(cell);
+        QueueRevealedNeighbours(cell);
+    }
+
+    bool MineSolver::IsSubset(const Constraint& small, const Constraint& big)
+    {
+        // Соседи перечисляются построчно, поэтому оба списка отсортированы
+        int j = 0;
+        for (int i = 0; i < small.count; i++)
+        {
+            while (j < big.count && big.cells[j] < small.cells[i]) j++;
+            if (j == big.count || big.cells[j] != small.cells[i]) return false;
+            j++;
+        }
+        return true;
+    }
+
+    bool MineSolver::ApplyDifference(const Constraint& small, const Constraint& big)
+    {
+        // В big \ small ровно big.need - small.need мин
+        int difference[8];
+        int count = 0;
+        int j = 0;
+        for (int i = 0; i < big.count; i++)
+        {
+            while (j < small.count && small.cells[j] < big.cells[i]) j++;
+            if (j < small.count && small.cells[j] == big.cells[i]) continue;
+            difference[count++] = big.cells[i];
+        }
+
+        int need = big.need - small.need;
+        if (count == 0 || (need != 0 && need != count))
+            return false;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (need == 0) MarkSafe(difference[i]);
+            else MarkMine(difference[i]);
+        }
+        return true;
+    }
+
+    void MineSolver::Propagate()
+    {
+        while (!work.empty())
+        {
+            int cell = work.back();
+            work.pop_back();
+            queued[cell] = 0;
+
+            Constraint constraint;
+            if (!BuildConstraint(cell, constraint) || constraint.count == 0)
+                continue;
+
+            // Правила одной клетки
+            if (constraint.need == 0 || constraint.need == constraint.count)
+            {
+                for (int i = 0; i < constraint.count; i++)
+                {
+                    if (constraint.need == 0) MarkSafe(constraint.cells[i]);
+                    else MarkMine(constraint.cells[i]);
+                }
+                continue;
+            }
+
+            // Правило вложенных пар: общие неизвестные соседи бывают только у клеток на расстоянии до 2
+            int row = cell / cols;
+            int col = cell % cols;
+            bool deduced = false;
+            for (int dr = -2; dr <= 2 && !deduced; dr++)
+            {
+                for (int dc = -2; dc <= 2 && !deduced; dc++)
+                {
+                    int r = row + dr;
+                    int c = col + dc;
+                    if ((dr == 0 && dc == 0) || r < 0 || r >= rows || c < 0 || c >= cols)
+                        continue;
+
+                    Constraint other;
+                    if (numbers[r * cols + c] <= 0 || !BuildConstraint(r * cols + c, other) || other.count == 0)
+                        continue;
+
+                    if (IsSubset(constraint, other))
+                        deduced = ApplyDifference(constraint, other);
+                    else if (IsSubset(other, constraint))
+                        deduced = ApplyDifference(other, constraint);
+                }
+            }
+
+            // Ограничение изменилось - пересмотрим его ещё раз
+            if (deduced)
+            {
+                Queue(cell);
+            }
+        }
+    }
+
+    bool MineSolver::Enumerate()
+    {
+        frontierProbabilities.clear();
+
+        // Убираем ограничения без неизвестных соседей
+        constraints.erase(std::remove_if(constraints.begin(), constraints.end(),
+            [this](int cell) {
+                Constraint constraint;
+                return !BuildConstraint(cell, constraint) || constraint.count == 0;
+            }), constraints.end());
+
+        // Связные компоненты границы: клетки связаны, если входят в одно ограничение
+        std::vector<Component> components;
+        int neighbours[8];
+        for (int start : constraints)
+        {
+            Constraint seed;
+            BuildConstraint(start, seed);
+            for (int s = 0; s < seed.count; s++)
+            {
+                if (componentOf[seed.cells[s]] >= 0)
+                    continue;
+
+                int id = static_cast<int>(components.size());
+                components.emplace_back();
+                Component& component = components.back();
+                componentOf[seed.cells[s]] = id;
+                component.cells.push_back(seed.cells[s]);
+
+                for (size_t next = 0; next < component.cells.size(); next++)
+                {
+                    int count = GetNeighbours(component.cells[next], neighbours);
+                    for (int i = 0; i < count; i++)
+                    {
+                        int owner = neighbours[i];
+                        Constraint constraint;
+                        if (constraintOf[owner] == id || numbers[owner] <= 0 ||
+                            !BuildConstraint(owner, constraint) || constraint.count == 0)
+                            continue;
+
+                        constraintOf[owner] = id;
+                        component.constraints.push_back(owner);
+                        for (int k = 0; k < constraint.count; k++)
+                        {
+                            if (componentOf[constraint.cells[k]] < 0)
+                            {
+                                componentOf[constraint.cells[k]] = id;
+                                component.cells.push_back(constraint.cells[k]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Перебор компонент с повторным использованием прошлых результатов
+        std::map<std::vector<int>, ComponentResult> cache;
+        std::vector<const ComponentResult*> results(components.size(), nullptr);
+        int enumeratedCells = 0;
+        int looseCells = 0;
+        for (size_t i = 0; i < components.size(); i++)
+        {
+            Component& component = components[i];
+            if (static_cast<int>(component.cells.size()) > MAX_COMPONENT_CELLS)
+            {
+                looseCells += static_cast<int>(component.cells.size());
+                continue;
+            }
+
+            std::vector<int> key(component.cells);
+            std::sort(key.begin(), key.end());
+            key.push_back(-1);
+            std::vector<int> owners(component.constraints);
+            std::sort(owners.begin(), owners.end());
+            key.insert(key.end(), owners.begin(), owners.end());
+
+            auto cached = componentCache.find(key);
+            auto inserted = cache.emplace(key, cached != componentCache.end() ?
+                std::move(cached->second) : EnumerateComponent(component));
+            results[i] = &inserted.first->second;
+            enumeratedCells += static_cast<int>(component.cells.size());
+        }
+        componentCache.swap(cache);
+
+        // Общий вес: распределения компонент сворачиваются между собой,
+        // а остальные неизвестные клетки принимают оставшиеся мины C(n, k) способами
+        const int remainingMines = totalMines - knownMines;
+        const int interiorCells = unknownCount - enumeratedCells;
+
+        std::vector<double> total(1, 1.0);
+        std::vector<std::vector<double>> prefix(1, total);
+        for (const ComponentResult* result : results)
+        {
+            if (result) total = Convolve(total, result->solutions);
+            prefix.push_back(total);
+        }
+
+        std::vector<double> weights(total.size(), 0.0);
+        double maxLog = -std::numeric_limits<double>::infinity();
+        std::vector<double> logs(total.size(), maxLog);
+        for (size_t s = 0; s < total.size(); s++)
+        {
+            int rest = remainingMines - static_cast<int>(s);
+            if (rest >= 0 && rest <= interiorCells)
+            {
+                logs[s] = LogBinomial(interiorCells, rest);
+                maxLog = std::max(maxLog, logs[s]);
+            }
+        }
+        for (size_t s = 0; s < total.size(); s++)
+        {
+            if (logs[s] > -std::numeric_limits<double>::infinity())
+                weights[s] = std::exp(logs[s] - maxLog);
+        }
+
+        double totalWeight = 0.0;
+        double interiorMines = 0.0;
+        bool interiorAllSafe = true;
+        bool interiorAllMines = true;
+        for (size_t s = 0; s < total.size(); s++)
+        {
+            double weight = total[s] * weights[s];
+            if (weight <= 0.0) continue;
+            int rest = remainingMines - static_cast<int>(s);
+            totalWeight += weight;
+            interiorMines += weight * rest;
+            interiorAllSafe = interiorAllSafe && rest == 0;
+            interiorAllMines = interiorAllMines && rest == interiorCells;
+        }
+
+        bool changed = false;
+        if (totalWeight <= 0.0)
+        {
+            // Противоречивое состояние (например, ложные данные) - только оценка по плотности
+            interiorProbability = unknownCount > 0 ? static_cast<double>(remainingMines) / unknownCount : 0.0;
+        }
+        else
+        {
+            interiorProbability = interiorCells > 0 ? interiorMines / (totalWeight * interiorCells) : 0.0;
+
+            std::vector<double> suffix(1, 1.0);
+            for (size_t i = components.size(); i-- > 0;)
+            {
+                const ComponentResult* result = results[i];
+                const Component& component = components[i];
+                if (!result)
+                {
+                    // Крупная компонента без перебора - оценка по плотности
+                    for (int cell : component.cells)
+                        frontierProbabilities[cell] = interiorProbability;
+                    continue;
+                }
+
+                // Вес каждого числа мин в этой компоненте с учётом всех остальных
+                std::vector<double> others = Convolve(prefix[i], suffix);
+                std::vector<double> factor(result->solutions.size(), 0.0);
+                for (size_t m = 0; m < factor.size(); m++)
+                {
+                    for (size_t r = 0; r < others.size() && m + r < weights.size(); r++)
+                    {
+                        factor[m] += others[r] * weights[m + r];
+                    }
+                }
+
+                for (size_t k = 0; k < component.cells.size(); k++)
+                {
+                    const std::vector<double>& mines = result->cellMines[k];
+                    double weight = 0.0;
+                    bool alwaysMine = true;
+                    for (size_t m = 0; m < factor.size(); m++)
+                    {
+                        weight += mines[m] * factor[m];
+                        if (factor[m] > 0.0 && result->solutions[m] > 0.0 && mines[m] != result->solutions[m])
+                            alwaysMine = false;
+                    }
+
+                    int cell = component.cells[k];
+                    if (weight == 0.0)
+                    {
+                        MarkSafe(cell);
+                        changed = true;
+                    }
+                    else if (alwaysMine)
+                    {
+                        MarkMine(cell);
+                        changed = true;
+                    }
+                    else
+                    {
+                        frontierProbabilities[cell] = weight / totalWeight;
+                    }
+                }
+
+                suffix = Convolve(suffix, result->solutions);
+            }
+
+            // Все остальные мины точно на границе (или точно внутри) - решаем внутренние клетки целиком.
+            // Крупные компоненты без перебора делают такой вывод ненадёжным
+            if (interiorCells > 0 && looseCells == 0 && (interiorAllSafe || interiorAllMines))
+            {
+                for (int cell = 0; cell < rows * cols; cell++)
+                {
+                    if (knowledge[cell] == static_cast<char>(Knowledge::Unknown) && componentOf[cell] < 0)
+                    {
+                        if (interiorAllSafe) MarkSafe(cell);
+                        else MarkMine(cell);
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        for (const Component& component : components)
+        {
+            for (int cell : component.cells) componentOf[cell] = -1;
+            for (int cell : component.constraints) constraintOf[cell] = -1;
+        }
+
+        if (changed)
+        {
+            frontierProbabilities.clear();
+        }
+        return changed;
+    }
+
+    MineSolver::ComponentResult MineSolver::EnumerateComponent(const Component& component)
+    {
+        const int cellsCount = static_cast<int>(component.cells.size());
+        const int constraintsCount = static_cast<int>(component.constraints.size());
+
+        // Локальные индексы клеток компоненты
+        std::unordered_map<int, int> local;
+        for (int i = 0; i < cellsCount; i++)
+        {
+            local[component.cells[i]] = i;
+        }
+
+        std::vector<int> need(constraintsCount);
+        std::vector<int> left(constraintsCount);
+        std::vector<std::vector<int>> cellConstraints(cellsCount);
+        for (int k = 0; k < constraintsCount; k++)
+        {
+            Constraint constraint;
+            BuildConstraint(component.constraints[k], constraint);
+            need[k] = constraint.need;
+            left[k] = constraint.count;
+            for (int i = 0; i < constraint.count; i++)
+            {
+                cellConstraints[local[constraint.cells[i]]].push_back(k);
+            }
+        }
+
+        ComponentResult result;
+        result.solutions.assign(cellsCount + 1, 0.0);
+        result.cellMines.assign(cellsCount, std::vector<double>(cellsCount + 1, 0.0));
+
+        std::vector<char> assigned(cellsCount, 0);
+        int mines = 0;
+
+        // Клетки идут в порядке обхода в ширину, поэтому ограничения закрываются рано
+        auto search = [&](auto& self, int index) -> void {
+            if (index == cellsCount)
+            {
+                result.solutions[mines] += 1.0;
+                for (int i = 0; i < cellsCount; i++)
+                {
+                    if (assigned[i]) result.cellMines[i][mines] += 1.0;
+                }
+                return;
+            }
+
+            for (int value = 0; value <= 1; value++)
+            {
+                bool valid = true;
+                for (int k : cellConstraints[index])
+                {
+                    need[k] -= value;
+                    left[k]--;
+                    if (need[k] < 0 || need[k] > left[k]) valid = false;
+                }
+
+                if (valid)
+                {
+                    assigned[index] = static_cast<char>(value);
+                    mines += value;
+                    self(self, index + 1);
+                    mines -= value;
+                    assigned[index] = 0;
+                }
+
+                for (int k : cellConstraints[index])
+                {
+                    need[k] += value;
+                    left[k]++;
+                }
+            }
+        };
+        search(search, 0);
+
+        // Нормируем, чтобы произведения по многим компонентам не переполнялись
+        double scale = *std::max_element(result.solutions.begin(), result.solutions.end());
+        if (scale > 0.0)
+        {
+            for (double& value : result.solutions) value /= scale;
+            for (auto& row : result.cellMines)
+                for (double& value : row) value /= scale;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,169 @@
+﻿#pragma once
+
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include "MineField.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Логический решатель "Сапёра" по открытой части поля.
+    /// Сначала применяет правила одной клетки и вложенных пар ограничений на границе,
+    /// затем точно перебирает небольшие связные компоненты границы и взвешивает
+    /// их решения по общему числу оставшихся мин.
+    /// Работает инкрементально: после хода передаются только новые открытые клетки,
+    /// а пересматриваются лишь затронутые ими ограничения
+    /// </summary>
+    class MineSolver
+    {
+    public:
+        /// <summary>
+        /// Что решатель знает о клетке
+        /// </summary>
+        enum class Knowledge : char
+        {
+            Unknown = 0,
+            Revealed = 1,   // Открыта, число известно
+            Safe = 2,       // Гарантированно без мины, но ещё не открыта
+            Mine = 3        // Гарантированно мина
+        };
+
+        /// <summary>
+        /// Подсказка: клетка, которую выгоднее всего открыть
+        /// </summary>
+        struct Hint
+        {
+            int row;
+            int col;
+            bool isCertain;          // Клетка гарантированно безопасна
+            double mineProbability;
+        };
+
+        // Компоненты границы крупнее этого размера не перебираются
+        static const int MAX_COMPONENT_CELLS = 20;
+
+    public:
+        /// <summary>
+        /// Конструктор решателя для поля rows x cols с totalMines минами
+        /// </summary>
+        MineSolver(int rows, int cols, int totalMines);
+
+        /// <summary>
+        /// Сообщает решателю об открытой клетке и её числе
+        /// </summary>
+        void Reveal(int row, int col, int minesAround);
+
+        /// <summary>
+        /// Передаёт решателю клетки, открытые последним ходом (индексы row * cols + col)
+        /// </summary>
+        void Apply(const MineField& field, const std::vector<int>& openedCells);
+
+        /// <summary>
+        /// Полная синхронизация со всеми открытыми клетками поля
+        /// </summary>
+        void Sync(const MineField& field);
+
+        /// <summary>
+        /// Доводит выводы до неподвижной точки и пересчитывает вероятности
+        /// </summary>
+        void Solve();
+
+        /// <summary>
+        /// Быстрый вариант Solve для проверки полей: перебор компонент запускается,
+        /// только если правил не хватило ни на одну безопасную клетку.
+        /// Вероятности после него актуальны лишь при пустом результате
+        /// </summary>
+        const std::vector<int>& FindSafeCells();
+
+        /// <summary>
+        /// Гарантированно безопасные ещё не открытые клетки (после Solve)
+        /// </summary>
+        const std::vector<int>& GetSafeCells() const { return safeCells; }
+
+        /// <summary>
+        /// Гарантированные мины (после Solve)
+        /// </summary>
+        const std::vector<int>& GetMineCells() const { return mineCells; }
+
+        /// <summary>
+        /// Вероятность мины в клетке (после Solve)
+        /// </summary>
+        double GetMineProbability(int row, int col) const;
+
+        Knowledge GetKnowledge(int row, int col) const { return static_cast<Knowledge>(knowledge[row * cols + col]); }
+
+        /// <summary>
+        /// Выбирает безопасную клетку, а если таких нет - клетку с наименьшим риском
+        /// </summary>
+        bool GetHint(Hint& hint) const;
+
+        int GetRows() const { return rows; }
+        int GetCols() const { return cols; }
+        int GetUnknownCount() const { return unknownCount; }
+
+    private:
+        /// <summary>
+        /// Ограничение открытой клетки: среди cells ровно need мин
+        /// </summary>
+        struct Constraint
+        {
+            int cells[8];
+            int count;
+            int need;
+        };
+
+        /// <summary>
+        /// Результат перебора компоненты: число решений по количеству мин
+        /// и число решений с миной в каждой клетке
+        /// </summary>
+        struct ComponentResult
+        {
+            std::vector<double> solutions;               // [mines]
+            std::vector<std::vector<double>> cellMines;  // [cell][mines]
+        };
+
+        struct Component
+        {
+            std::vector<int> cells;
+            std::vector<int> constraints;
+        };
+
+        int rows;
+        int cols;
+        int totalMines;
+        int unknownCount;
+        int knownMines;
+
+        std::vector<signed char> numbers;   // Числа открытых клеток
+        std::vector<char> knowledge;        // Knowledge по клеткам
+        std::vector<char> queued;           // Клетка уже в очереди work
+        std::vector<int> work;              // Открытые клетки, ожидающие пересмотра
+        std::vector<int> constraints;       // Открытые клетки с ненулевым числом
+        std::vector<int> safeCells;
+        std::vector<int> mineCells;
+
+        // Рабочие массивы перебора (заполнены -1 между вызовами)
+        std::vector<int> componentOf;
+        std::vector<int> constraintOf;
+
+        std::unordered_map<int, double> frontierProbabilities;
+        double interiorProbability;
+
+        // Результаты перебора прошлого вызова: компоненты, не затронутые ходом, не пересчитываются
+        std::map<std::vector<int>, ComponentResult> componentCache;
+
+    private:
+        int GetNeighbours(int cell, int* out) const;
+        bool BuildConstraint(int cell, Constraint& constraint) const;
+        void Queue(int cell);
+        void QueueRevealedNeighbours(int cell);
+        void MarkSafe(int cell);
+        void MarkMine(int cell);
+        bool ApplyDifference(const Constraint& small, const Constraint& big);
+        void Propagate();
+        bool Enumerate();
+        ComponentResult EnumerateComponent(const Component& component);
+        static bool IsSubset(const Constraint& small, const Constraint& big);
+    };
+}
@@ -4,12 +4,15 @@ namespace MineSweeper {
 
     MineSweeperForm::MineSweeperForm()
         : mineField(nullptr), gameTimer(nullptr), difficultyManager(nullptr),
-        inputHandler(nullptr), gameState(nullptr), cellButtons(nullptr),
-        updatingDifficulty(false)
+        inputHandler(nullptr), gameState(nullptr), mineSolver(nullptr), statistics(nullptr), cellPool(nullptr),
+        viewport(nullptr), updatingDifficulty(false), syncingScroll(false), generatingMines(false), pendingRow(0), pendingCol(0)
     {
         try {
             InitializeComponent();
+            OpenStatistics();
+            CreateCellButtons();
             InitializeGame();
+            ResumeSavedGame();
         }
         catch (Exception^ ex) {
             MessageBox::Show(
@@ -47,6 +50,9 @@ namespace MineSweeper {
         delete difficultyManager;
         delete inputHandler;
         delete gameState;
+        delete mineSolver;
+        delete statistics;
+        delete viewport;
     }
 
     System::String^ MineSweeperForm::ToSystemString(const std::string& str)
@@ -60,8 +66,12 @@ namespace MineSweeper {
 
         this->buttonRestart = (gcnew System::Windows::Forms::Button());
         this->comboBoxDifficulty = (gcnew System::Windows::Forms::ComboBox());
+        this->checkBoxNoGuess = (gcnew System::Windows::Forms::CheckBox());
+        this->buttonHint = (gcnew System::Windows::Forms::Button());
         this->labelTimer = (gcnew System::Windows::Forms::Label());
         this->gamePanel = (gcnew System::Windows::Forms::Panel());
+        this->scrollRows = (gcnew System::Windows::Forms::VScrollBar());
+        this->scrollCols = (gcnew System::Windows::Forms::HScrollBar());
         this->updateTimer = (gcnew System::Windows::Forms::Timer(this->components));
 
         this->SuspendLayout();
@@ -88,11 +98,29 @@ namespace MineSweeper {
             static_cast<System::Byte>(0)));
         this->labelTimer->Location = System::Drawing::Point(224, 12);
         this->labelTimer->Name = L"labelTimer";
-        this->labelTimer->Size = System::Drawing::Size(120, 30);
+        this->labelTimer->Size = System::Drawing::Size(100, 30);
         this->labelTimer->TabIndex = 2;
         this->labelTimer->Text = L"Время: 10:00";
         this->labelTimer->TextAlign = System::Drawing::ContentAlignment::MiddleLeft;
 
+        // checkBoxNoGuess
+        this->checkBoxNoGuess->Location = System::Drawing::Point(330, 17);
+        this->checkBoxNoGuess->Name = L"checkBoxNoGuess";
+        this->checkBoxNoGuess->Size = System::Drawing::Size(115, 20);
+        this->checkBoxNoGuess->TabIndex = 4;
+        this->checkBoxNoGuess->Text = L"Без угадывания";
+        this->checkBoxNoGuess->UseVisualStyleBackColor = true;
+        this->checkBoxNoGuess->CheckedChanged += gcnew System::EventHandler(this, &MineSweeperForm::checkBoxNoGuess_CheckedChanged);
+
+        // buttonHint
+        this->buttonHint->Location = System::Drawing::Point(448, 12);
+        this->buttonHint->Name = L"buttonHint";
+        this->buttonHint->Size = System::Drawing::Size(80, 30);
+        this->buttonHint->TabIndex = 5;
+        this->buttonHint->Text = L"Подсказка";
+        this->buttonHint->UseVisualStyleBackColor = true;
+        this->buttonHint->Click += gcnew System::EventHandler(this, &MineSweeperForm::buttonHint_Click);
+
         // gamePanel
         this->gamePanel->Location = System::Drawing::Point(12, 48);
         this->gamePanel->Name = L"gamePanel";
@@ -100,8 +128,20 @@ namespace MineSweeper {
         this->gamePanel->TabIndex = 3;
         this->gamePanel->BackColor = System::Drawing::Color::LightGray;
 
-        // updateTimer
-        this->updateTimer->Interval = 1000;
+        // scrollRows / scrollCols - прокрутка полей, не помещающихся в панель
+        this->scrollRows->Dock = System::Windows::Forms::DockStyle::Right;
+        this->scrollRows->Name = L"scrollRows";
+        this->scrollRows->Visible = false;
+        this->scrollRows->ValueChanged += gcnew System::EventHandler(this, &MineSweeperForm::scrollField_ValueChanged);
+        this->scrollCols->Dock = System::Windows::Forms::DockStyle::Bottom;
+        this->scrollCols->Name = L"scrollCols";
+        this->scrollCols->Visible = false;
+        this->scrollCols->ValueChanged += gcnew System::EventHandler(this, &MineSweeperForm::scrollField_ValueChanged);
+        this->gamePanel->Controls->Add(this->scrollRows);
+        this->gamePanel->Controls->Add(this->scrollCols);
+
+        // updateTimer: только перерисовывает таймер, время считает GameTimer
+        this->updateTimer->Interval = 200;
         this->updateTimer->Tick += gcnew System::EventHandler(this, &MineSweeperForm::updateTimer_Tick);
 
         // MineSweeperForm
@@ -109,6 +149,8 @@ namespace MineSweeper {
         this->AutoScaleMode = System::Windows::Forms::AutoScaleMode::Font;
         this->ClientSize = System::Drawing::Size(540, 576);
         this->Controls->Add(this->gamePanel);
+        this->Controls->Add(this->buttonHint);
+        this->Controls->Add(this->checkBoxNoGuess);
         this->Controls->Add(this->labelTimer);
         this->Controls->Add(this->comboBoxDifficulty);
         this->Controls->Add(this->buttonRestart);
@@ -116,14 +158,47 @@ namespace MineSweeper {
         this->MaximizeBox = false;
         this->Name = L"MineSweeperForm";
         this->Text = L"Сапёр";
+        this->KeyPreview = true;
+        this->KeyDown += gcnew System::Windows::Forms::KeyEventHandler(this, &MineSweeperForm::MineSweeperForm_KeyDown);
+        this->Resize += gcnew System::EventHandler(this, &MineSweeperForm::MineSweeperForm_Resize);
+        this->FormClosing += gcnew System::Windows::Forms::FormClosingEventHandler(this, &MineSweeperForm::MineSweeperForm_FormClosing);
         this->ResumeLayout(false);
     }
 
+    System::Void MineSweeperForm::OpenStatistics()
+    {
+        // Без статистики играть можно: повреждённый журнал только отключает её
+        try {
+            statistics = new StatisticsStore(StatisticsStore::GetDefaultPath("Player"));
+
+            if (statistics->GetSkippedRecords() > 0)
+            {
+                String^ message = ToSystemString("Пропущено повреждённых записей статистики: " +
+                    std::to_string(statistics->GetSkippedRecords()));
+                MessageBox::Show(message, L"Предупреждение", MessageBoxButtons::OK, MessageBoxIcon::Warning);
+            }
+        }
+        catch (const std::exception& ex) {
+            statistics = nullptr;
+            String^ message = ToSystemString("Статистика не загружена: " + std::string(ex.what()));
+            MessageBox::Show(message, L"Предупреждение", MessageBoxButtons::OK, MessageBoxIcon::Warning);
+        }
+    }
+
     System::Void MineSweeperForm::InitializeGame()
     {
         try {
             if (!difficultyManager) {
                 difficultyManager = new DifficultyManager();
+
+                // Ошибка в файле уровней не мешает играть на встроенных
+                try {
+                    difficultyManager->LoadPresetsFromFile(DifficultyManager::DEFAULT_PRESETS_FILE);
+                }
+                catch (const std::exception& ex) {
+                    String^ message = ToSystemString("Файл уровней не загружен: " + std::string(ex.what()));
+                    MessageBox::Show(message, L"Предупреждение", MessageBoxButtons::OK, MessageBoxIcon::Warning);
+                }
             }
 
             // Заполнение комбобокса сложностями
@@ -144,8 +219,14 @@ namespace MineSweeper {
 
             // Инициализация игровых компонентов
             // Удаляем старое поле перед созданием нового
+            // Мины расставляются при первом ходе, чтобы он всегда был безопасным
             delete mineField;
-            mineField = new MineField(settings.gridSize, settings.minesCount);
+            mineField = new MineField(FieldSize{ settings.rows, settings.cols }, settings.minesCount,
+                checkBoxNoGuess->Checked ? MineField::GenerationMode::NoGuess : MineField::GenerationMode::FirstClickSafe);
+
+            // Незавершённая генерация прошлого поля отменена вместе с ним
+            generatingMines = false;
+            gamePanel->Enabled = true;
 
             // Пересоздаем таймер с новыми настройками
             delete gameTimer;
@@ -158,8 +239,12 @@ namespace MineSweeper {
             delete gameState;
             gameState = new GameState();
 
+            // Решатель для подсказок получает только открытые клетки
+            delete mineSolver;
+            mineSolver = new MineSolver(settings.rows, settings.cols, settings.minesCount);
+
             // Создание клеток интерфейса
-            CreateCellButtons();
+            LayoutCellButtons();
 
             // Начало игры
             gameState->StartNewGame();
@@ -184,40 +269,80 @@ namespace MineSweeper {
 
     System::Void MineSweeperForm::CreateCellButtons()
     {
-        if (cellButtons != nullptr)
+        if (cellPool != nullptr) return;
+
+        viewport = new FieldViewport(gamePanel->ClientSize.Width, gamePanel->ClientSize.Height,
+            MIN_CELL_SIZE, SystemInformation::VerticalScrollBarWidth);
+
+        cellFont = gcnew Drawing::Font("Arial", 10, Drawing::FontStyle::Bold);
+        numberColors = gcnew array<Color> {
+            Color::Blue, Color::Green, Color::Red,
+                Color::DarkBlue, Color::DarkRed, Color::Teal,
+                Color::Black, Color::Gray
+        };
+
+        // Пул рассчитан на самые мелкие клетки и больше не пересоздается
+        cellPool = gcnew array<Button^>(viewport->GetMaxSlots());
+
+        gamePanel->SuspendLayout();
+        for (int slot = 0; slot < cellPool->Length; slot++)
         {
-            for each (Button ^ btn in cellButtons)
-            {
-                if (btn != nullptr)
-                {
-                    gamePanel->Controls->Remove(btn);
-                    delete btn;
-                }
-            }
+            Button^ btn = gcnew Button();
+            btn->Tag = slot;
+            btn->Font = cellFont;
+            btn->Visible = false;
+            btn->MouseUp += gcnew MouseEventHandler(this, &MineSweeperForm::cellButton_MouseUp); // Изменили на MouseUp
+            btn->MouseDown += gcnew MouseEventHandler(this, &MineSweeperForm::cellButton_MouseDown); // Добавили MouseDown
+
+            gamePanel->Controls->Add(btn);
+            cellPool[slot] = btn;
         }
+        gamePanel->ResumeLayout(false);
+    }
 
-        if (mineField == nullptr) return;
+    System::Void MineSweeperForm::LayoutCellButtons()
+    {
+        if (mineField == nullptr || viewport == nullptr) return;
 
-        int gridSize = mineField->GetGridSize();
-        cellButtons = gcnew array<Button^, 2>(gridSize, gridSize);
-        int cellSize = gamePanel->Width / gridSize;
+        viewport->Attach(*mineField);
 
-        for (int r = 0; r < gridSize; r++)
+        int cellSize = viewport->GetCellSize();
+        int visibleCols = viewport->GetVisibleCols();
+        int slotCount = viewport->GetSlotCount();
+
+        gamePanel->SuspendLayout();
+        for (int slot = 0; slot < cellPool->Length; slot++)
         {
-            for (int c = 0; c < gridSize; c++)
+            Button^ btn = cellPool[slot];
+            if (slot < slotCount)
             {
-                Button^ btn = gcnew Button();
                 btn->Size = Drawing::Size(cellSize, cellSize);
-                btn->Location = Drawing::Point(cellSize * c, cellSize * r);
-                btn->Tag = Point(r, c);
-                btn->Font = gcnew Drawing::Font("Arial", 10, Drawing::FontStyle::Bold);
-                btn->MouseUp += gcnew MouseEventHandler(this, &MineSweeperForm::cellButton_MouseUp); // Изменили на MouseUp
-                btn->MouseDown += gcnew MouseEventHandler(this, &MineSweeperForm::cellButton_MouseDown); // Добавили MouseDown
-
-                gamePanel->Controls->Add(btn);
-                cellButtons[r, c] = btn;
+                btn->Location = Drawing::Point(cellSize * (slot % visibleCols), cellSize * (slot / visibleCols));
+                btn->Visible = true;
+            }
+            else
+            {
+                btn->Visible = false;
             }
         }
+        gamePanel->ResumeLayout(false);
+
+        // Значения полос прокрутки - первая видимая строка и столбец окна
+        scrollRows->Visible = viewport->NeedsRowScroll();
+        scrollCols->Visible = viewport->NeedsColScroll();
+        scrollRows->Value = 0;
+        scrollRows->Maximum = mineField->GetRows() - 1;
+        scrollRows->LargeChange = viewport->GetVisibleRows();
+        scrollCols->Value = 0;
+        scrollCols->Maximum = mineField->GetCols() - 1;
+        scrollCols->LargeChange = visibleCols;
+    }
+
+    Point MineSweeperForm::GetCellOfButton(Button^ btn)
+    {
+        int row, col;
+        viewport->FromSlot(safe_cast<int>(btn->Tag), row, col);
+        return Point(row, col);
     }
 
     System::Void MineSweeperForm::cellButton_MouseDown(System::Object^ sender, System::Windows::Forms::MouseEventArgs^ e)
@@ -235,8 +360,7 @@ namespace MineSweeper {
             if (gameState == nullptr || !gameState->IsGameActive() || mineField == nullptr)
                 return;
 
-            Button^ btn = safe_cast<Button^>(sender);
-            Point point = safe_cast<Point>(btn->Tag);
+            Point point = GetCellOfButton(safe_cast<Button^>(sender));
             int row = point.X;
             int col = point.Y;
 
@@ -245,30 +369,28 @@ namespace MineSweeper {
             {
                 // Правая кнопка - установка/снятие флага
                 mineField->ToggleFlag(row, col);
-                UpdateGameDisplay();
+                gameState->ProcessFlagToggle(row, col);
+                UpdateCellDisplay(row, col);
+            }
+            else if (e->Button == System::Windows::Forms::MouseButtons::Middle ||
+                (e->Button == System::Windows::Forms::MouseButtons::Left && mineField->IsOpened(row, col)))
+            {
+                // Средняя кнопка или повторный щелчок по открытой цифре - аккорд
+                ProcessOpenResult(mineField->Chord(row, col), row, col);
             }
             else if (e->Button == System::Windows::Forms::MouseButtons::Left)
             {
                 // Левая кнопка - открытие клетки
-                if (!mineField->IsFlagged(row, col))
+                if (mineField->IsFlagged(row, col))
+                    return;
+
+                // Поле без угадывания ищется в фоне, ход завершит PollPendingOpen
+                if (mineField->BeginMinePlacement(row, col))
                 {
-                    bool success = mineField->OpenCell(row, col);
-                    if (!success) // Наступили на мину
-                    {
-                        gameState->ProcessCellOpen(true);
-                        HandleGameOver(GameState::GameStatus::Lost);
-                    }
-                    else
-                    {
-                        // Проверяем победу после успешного открытия
-                        if (mineField->CheckWin())
-                        {
-                            gameState->CheckGameCompletion(true, false);
-                            HandleGameOver(GameState::GameStatus::Won);
-                        }
-                    }
-                    UpdateGameDisplay();
+                    BeginPendingOpen(row, col);
+                    return;
                 }
+                ProcessOpenResult(mineField->OpenCell(row, col), row, col);
             }
         }
         catch (const std::exception& ex) {
@@ -280,55 +402,158 @@ namespace MineSweeper {
         }
     }
 
+    System::Void MineSweeperForm::BeginPendingOpen(int row, int col)
+    {
+        generatingMines = true;
+        pendingRow = row;
+        pendingCol = col;
+
+        gamePanel->Enabled = false;
+        gameTimer->Pause();
+        PollPendingOpen();
+    }
+
+    System::Void MineSweeperForm::PollPendingOpen()
+    {
+        if (mineField->IsGeneratingMines())
+        {
+            labelTimer->Text = String::Format(L"Генерация поля: {0}%",
+                static_cast<int>(mineField->GetGenerationProgress() * 100));
+            return;
+        }
+
+        generatingMines = false;
+        gamePanel->Enabled = true;
+        gameTimer->Resume();
+        UpdateTimerDisplay();
+
+        ProcessOpenResult(mineField->OpenCell(pendingRow, pendingCol), pendingRow, pendingCol);
+    }
+
+    System::Void MineSweeperForm::ProcessOpenResult(bool success, int row, int col)
+    {
+        if (!success) // Наступили на мину
+        {
+            gameState->ProcessCellOpen(true, row, col);
+            HandleGameOver(GameState::GameStatus::Lost);
+            UpdateGameDisplay();
+            return;
+        }
+
+        // Аккорд без совпадения флагов ничего не открыл - это не ход
+        const std::vector<int>& openedCells = mineField->GetLastOpenedCells();
+        if (openedCells.empty())
+            return;
+
+        gameState->ProcessCellOpen(false, row, col);
+
+        if (mineSolver != nullptr)
+        {
+            mineSolver->Apply(*mineField, openedCells);
+        }
+
+        // Перерисовываем только клетки, открытые этим ходом
+        int cols = mineField->GetCols();
+        for (int cell : openedCells)
+        {
+            UpdateCellDisplay(cell / cols, cell % cols);
+        }
+
+        // Проверяем победу после успешного открытия
+        if (mineField->CheckWin())
+        {
+            gameState->CheckGameCompletion(true, false);
+            HandleGameOver(GameState::GameStatus::Won);
+            UpdateGameDisplay();
+        }
+    }
+
     System::Void MineSweeperForm::UpdateGameDisplay()
     {
-        if (mineField == nullptr || cellButtons == nullptr) return;
+        if (mineField == nullptr || viewport == nullptr) return;
+
+        for (int slot = 0; slot < viewport->GetSlotCount(); slot++)
+        {
+            RenderSlot(slot);
+        }
+    }
 
-        int gridSize = mineField->GetGridSize();
+    System::Void MineSweeperForm::UpdateCellDisplay(int row, int col)
+    {
+        if (mineField == nullptr || viewport == nullptr) return;
 
-        for (int r = 0; r < gridSize; r++)
+        // Клетки вне видимого окна не имеют кнопок
+        int slot;
+        if (viewport->ToSlot(row, col, slot))
         {
-            for (int c = 0; c < gridSize; c++)
-            {
-                Button^ btn = cellButtons[r, c];
-                auto cellState = mineField->GetCellState(r, c);
+            RenderSlot(slot);
+        }
+    }
 
-                if (cellState.isOpened)
-                {
-                    btn->Enabled = false;
-                    btn->BackColor = Color::LightGray;
-
-                    if (cellState.isMine)
-                    {
-                        btn->Text = L"💣";
-                        btn->BackColor = Color::Red;
-                    }
-                    else if (cellState.minesAround > 0)
-                    {
-                        btn->Text = cellState.minesAround.ToString();
-                        // Установка цвета в зависимости от количества мин
-                        array<Color>^ colors = gcnew array<Color> {
-                            Color::Blue, Color::Green, Color::Red,
-                                Color::DarkBlue, Color::DarkRed, Color::Teal,
-                                Color::Black, Color::Gray
-                        };
-
-                        if (cellState.minesAround <= colors->Length)
-                        {
-                            btn->ForeColor = colors[cellState.minesAround - 1];
-                        }
-                    }
-                }
-                else
-                {
-                    btn->Enabled = (gameState != nullptr && gameState->IsGameActive());
-                    btn->BackColor = Color::White;
-                    btn->Text = cellState.isFlagged ? L"🚩" : L"";
-                }
+    System::Void MineSweeperForm::RenderSlot(int slot)
+    {
+        Button^ btn = cellPool[slot];
+        FieldViewport::CellRender render = viewport->GetRenderState(slot);
+
+        // Открытая клетка остается доступной для аккорда, пока идет игра
+        btn->Enabled = (gameState != nullptr && gameState->IsGameActive());
+
+        switch (render.visual)
+        {
+        case FieldViewport::CellVisual::Opened:
+            btn->FlatStyle = FlatStyle::Flat;
+            btn->BackColor = Color::LightGray;
+            btn->Text = render.minesAround > 0 ? render.minesAround.ToString() : L"";
+            if (render.minesAround > 0 && render.minesAround <= numberColors->Length)
+            {
+                // Установка цвета в зависимости от количества мин
+                btn->ForeColor = numberColors[render.minesAround - 1];
             }
+            break;
+
+        case FieldViewport::CellVisual::ExplodedMine:
+            btn->FlatStyle = FlatStyle::Flat;
+            btn->BackColor = Color::Red;
+            btn->Text = L"💣";
+            break;
+
+        case FieldViewport::CellVisual::Mine:
+            btn->FlatStyle = FlatStyle::Standard;
+            btn->BackColor = Color::LightGray;
+            btn->Text = L"💣";
+            break;
+
+        default:
+            btn->FlatStyle = FlatStyle::Standard;
+            btn->BackColor = Color::White;
+            btn->Text = render.visual == FieldViewport::CellVisual::Flagged ? L"🚩" : L"";
+            break;
         }
     }
 
+    System::Void MineSweeperForm::EnsureCellVisible(int row, int col)
+    {
+        if (viewport == nullptr || !viewport->EnsureVisible(row, col)) return;
+
+        // Полосы прокрутки повторяют окно. Присваивание Value сразу вызывает ValueChanged,
+        // который прокрутил бы окно к ещё не обновлённой второй полосе, поэтому он подавляется;
+        // клетки перерисовывает вызывающий
+        int firstRow = viewport->GetFirstRow();
+        int firstCol = viewport->GetFirstCol();
+        syncingScroll = true;
+        scrollRows->Value = firstRow;
+        scrollCols->Value = firstCol;
+        syncingScroll = false;
+    }
+
+    System::Void MineSweeperForm::scrollField_ValueChanged(System::Object^ sender, System::EventArgs^ e)
+    {
+        if (viewport == nullptr || syncingScroll) return;
+
+        viewport->ScrollTo(scrollRows->Value, scrollCols->Value);
+        UpdateGameDisplay();
+    }
+
     System::Void MineSweeperForm::UpdateTimerDisplay()
     {
         if (gameTimer == nullptr || labelTimer == nullptr) return;
@@ -343,25 +568,167 @@ namespace MineSweeper {
         if (gameTimer != nullptr) gameTimer->Stop();
 
         // Показываем все мины
-        if (mineField != nullptr && cellButtons != nullptr)
+        if (viewport != nullptr)
         {
-            for (int r = 0; r < mineField->GetGridSize(); r++)
+            viewport->SetRevealMines(true);
+            UpdateGameDisplay();
+        }
+
+        std::string message = GameState::GetStatusDescription(status);
+        if (gameTimer != nullptr)
+        {
+            // Время партии с точностью до миллисекунды, независимо от тиков updateTimer
+            long long elapsed = gameTimer->GetElapsedMilliseconds();
+            message += "\nВремя: " + GameTimer::FormatMilliseconds(elapsed);
+
+            if (statistics != nullptr && mineField != nullptr)
             {
-                for (int c = 0; c < mineField->GetGridSize(); c++)
+                // Статистика ведётся по самому полю партии, а не по номеру уровня в списке
+                StatisticsStore::BoardKey board = { mineField->GetRows(), mineField->GetCols(), mineField->GetMinesCount() };
+                bool won = status == GameState::GameStatus::Won;
+                try {
+                    statistics->AddGameResult(won, static_cast<int>(elapsed), board);
+                }
+                catch (const std::exception& ex) {
+                    message += "\nСтатистика не сохранена: " + std::string(ex.what());
+                }
+
+                const StatisticsStore::Aggregate& aggregate = statistics->GetByBoard(board);
+                if (aggregate.GetBestTime() > 0)
                 {
-                    if (mineField->IsMine(r, c))
-                    {
-                        cellButtons[r, c]->Text = L"💣";
-                        cellButtons[r, c]->BackColor = mineField->IsOpened(r, c) ? Color::Red : Color::LightGray;
-                    }
+                    message += "\nЛучшее время: " + GameTimer::FormatMilliseconds(aggregate.GetBestTime());
+                    message += "\nМедиана: " + GameTimer::FormatMilliseconds(
+                        static_cast<long long>(aggregate.GetTimePercentile(0.5)));
                 }
+                message += "\nПобед: " + std::to_string(aggregate.wins) + " из " + std::to_string(aggregate.games);
             }
         }
-
-        std::string message = GameState::GetStatusDescription(status);
         MessageBox::Show(ToSystemString(message), L"Игра окончена", MessageBoxButtons::OK, MessageBoxIcon::Information);
     }
 
+    System::Void MineSweeperForm::MineSweeperForm_KeyDown(System::Object^ sender, System::Windows::Forms::KeyEventArgs^ e)
+    {
+        if (!e->Control) return;
+
+        if (e->KeyCode == Keys::Z)
+        {
+            UndoMove();
+            e->Handled = true;
+        }
+        else if (e->KeyCode == Keys::Y)
+        {
+            RedoMove();
+            e->Handled = true;
+        }
+    }
+
+    System::Void MineSweeperForm::UndoMove()
+    {
+        // Отменять можно только ходы незаконченной партии
+        if (gameState == nullptr || !gameState->IsGameActive() || mineField == nullptr)
+            return;
+
+        if (!mineField->Undo())
+            return;
+
+        gameState->ProcessUndo();
+
+        // Решатель не умеет забывать клетки: он будет пересобран при следующей подсказке
+        delete mineSolver;
+        mineSolver = nullptr;
+
+        UpdateGameDisplay();
+    }
+
+    System::Void MineSweeperForm::RedoMove()
+    {
+        if (gameState == nullptr || !gameState->IsGameActive() || mineField == nullptr)
+            return;
+
+        if (!mineField->Redo())
+            return;
+
+        gameState->ProcessRedo();
+
+        if (mineSolver != nullptr)
+        {
+            mineSolver->Apply(*mineField, mineField->GetLastOpenedCells());
+        }
+        UpdateGameDisplay();
+
+        if (mineField->CheckWin())
+        {
+            gameState->CheckGameCompletion(true, false);
+            HandleGameOver(GameState::GameStatus::Won);
+        }
+    }
+
+    System::Void MineSweeperForm::MineSweeperForm_Resize(System::Object^ sender, System::EventArgs^ e)
+    {
+        if (gameTimer == nullptr || gameState == nullptr || !gameState->IsGameActive()) return;
+
+        // Свёрнутое окно ставит партию на паузу
+        if (this->WindowState == FormWindowState::Minimized)
+        {
+            gameTimer->Pause();
+        }
+        else if (!gameTimer->IsRunning() && !generatingMines)
+        {
+            gameTimer->Resume();
+            UpdateTimerDisplay();
+        }
+    }
+
+    System::Void MineSweeperForm::ResumeSavedGame()
+    {
+        if (!GameSnapshot::Exists(GameSnapshot::DEFAULT_SAVE_FILE)) return;
+
+        try {
+            int difficulty = GameSnapshot::Load(GameSnapshot::DEFAULT_SAVE_FILE, *mineField, *gameState, *gameTimer);
+            GameSnapshot::Remove(GameSnapshot::DEFAULT_SAVE_FILE);
+
+            if (difficulty >= 0 && difficulty < difficultyManager->GetDifficultyCount())
+            {
+                difficultyManager->SetDifficulty(difficulty);
+                updatingDifficulty = true;
+                comboBoxDifficulty->SelectedIndex = difficulty;
+                updatingDifficulty = false;
+            }
+
+            // Решатель и окно пересобираются по восстановленному полю
+            delete mineSolver;
+            mineSolver = new MineSolver(mineField->GetRows(), mineField->GetCols(), mineField->GetMinesCount());
+            mineSolver->Sync(*mineField);
+
+            LayoutCellButtons();
+            UpdateGameDisplay();
+            UpdateTimerDisplay();
+        }
+        catch (const std::exception& ex) {
+            updatingDifficulty = false;
+            GameSnapshot::Remove(GameSnapshot::DEFAULT_SAVE_FILE);
+            String^ message = ToSystemString("Сохранённая игра не загружена: " + std::string(ex.what()));
+            MessageBox::Show(message, L"Предупреждение", MessageBoxButtons::OK, MessageBoxIcon::Warning);
+        }
+    }
+
+    System::Void MineSweeperForm::MineSweeperForm_FormClosing(System::Object^ sender, System::Windows::Forms::FormClosingEventArgs^ e)
+    {
+        try {
+            // Сохраняем только начатую и незаконченную партию
+            if (mineField != nullptr && gameState != nullptr && gameTimer != nullptr &&
+                gameState->IsGameActive() && mineField->AreMinesPlaced())
+            {
+                GameSnapshot::Save(GameSnapshot::DEFAULT_SAVE_FILE, *mineField, *gameState, *gameTimer,
+                    difficultyManager->GetCurrentDifficulty());
+            }
+        }
+        catch (const std::exception& ex) {
+            String^ message = ToSystemString("Не удалось сохранить игру: " + std::string(ex.what()));
+            MessageBox::Show(message, L"Ошибка", MessageBoxButtons::OK, MessageBoxIcon::Error);
+        }
+    }
+
     System::Void MineSweeperForm::buttonRestart_Click(System::Object^ sender, System::EventArgs^ e)
     {
         try {
@@ -375,6 +742,7 @@ namespace MineSweeper {
             // delete difficultyManager; // ЭТУ СТРОКУ КОММЕНТИРУЕМ ИЛИ УДАЛЯЕМ
             delete inputHandler;
             delete gameState;
+            delete mineSolver;
 
             // Сбрасываем указатели
             mineField = nullptr;
@@ -382,6 +750,7 @@ namespace MineSweeper {
             // difficultyManager = nullptr; // ЭТУ СТРОКУ КОММЕНТИРУЕМ ИЛИ УДАЛЯЕМ
             inputHandler = nullptr;
             gameState = nullptr;
+            mineSolver = nullptr;
 
             // Инициализируем заново (с сохраненной сложностью)
             InitializeGame();
@@ -417,12 +786,60 @@ namespace MineSweeper {
         }
     }
 
+    System::Void MineSweeperForm::checkBoxNoGuess_CheckedChanged(System::Object^ sender, System::EventArgs^ e)
+    {
+        // Режим генерации влияет только на новое поле
+        buttonRestart_Click(sender, e);
+    }
+
+    System::Void MineSweeperForm::buttonHint_Click(System::Object^ sender, System::EventArgs^ e)
+    {
+        try {
+            if (gameState == nullptr || !gameState->IsGameActive() || mineField == nullptr || viewport == nullptr ||
+                generatingMines)
+                return;
+
+            // После отмены хода решатель собирается заново по открытой части поля
+            if (mineSolver == nullptr)
+            {
+                mineSolver = new MineSolver(mineField->GetRows(), mineField->GetCols(), mineField->GetMinesCount());
+                mineSolver->Sync(*mineField);
+            }
+
+            // Решатель пересматривает только ограничения, затронутые ходами с прошлой подсказки
+            mineSolver->Solve();
+
+            MineSolver::Hint hint;
+            if (!mineSolver->GetHint(hint))
+                return;
+
+            // Зелёный - клетка точно безопасна, жёлтый - лишь наименьший риск
+            EnsureCellVisible(hint.row, hint.col);
+            UpdateGameDisplay();
+
+            int slot;
+            if (viewport->ToSlot(hint.row, hint.col, slot))
+            {
+                cellPool[slot]->BackColor = hint.isCertain ? Color::LightGreen : Color::Khaki;
+            }
+        }
+        catch (const std::exception& ex) {
+            String^ message = ToSystemString("Ошибка при поиске подсказки: " + std::string(ex.what()));
+            MessageBox::Show(message, L"Ошибка", MessageBoxButtons::OK, MessageBoxIcon::Error);
+        }
+    }
+
     System::Void MineSweeperForm::updateTimer_Tick(System::Object^ sender, System::EventArgs^ e)
     {
         try {
             if (gameTimer == nullptr || gameState == nullptr || mineField == nullptr) return;
 
-            gameTimer->Update();
+            if (generatingMines)
+            {
+                PollPendingOpen();
+                return;
+            }
+
             UpdateTimerDisplay();
 
             // Проверяем победу
@@ -449,46 +866,4 @@ namespace MineSweeper {
             if (updateTimer != nullptr) updateTimer->Stop();
         }
     }
-
-    System::Void MineSweeperForm::cellButton_MouseClick(System::Object^ sender, System::Windows::Forms::MouseEventArgs^ e)
-    {
-        try {
-            if (gameState == nullptr || !gameState->IsGameActive() || mineField == nullptr)
-                return;
-
-            Button^ btn = safe_cast<Button^>(sender);
-            Point point = safe_cast<Point>(btn->Tag);
-            int row = point.X;
-            int col = point.Y;
-
-            InputHandler::MouseButton button = (e->Button == System::Windows::Forms::MouseButtons::Right) ?
-                InputHandler::MouseButton::Right : InputHandler::MouseButton::Left;
-
-            if (button == InputHandler::MouseButton::Right)
-            {
-                mineField->ToggleFlag(row, col);
-            }
-            else
-            {
-                if (!mineField->IsFlagged(row, col))
-                {
-                    bool success = mineField->OpenCell(row, col);
-                    if (!success) // Наступили на мину
-                    {
-                        gameState->ProcessCellOpen(true);
-                        HandleGameOver(GameState::GameStatus::Lost);
-                    }
-                }
-            }
-
-            UpdateGameDisplay();
-        }
-        catch (const std::exception& ex) {
-            String^ message = ToSystemString("Ошибка при клике по клетке: " + std::string(ex.what()));
-            MessageBox::Show(message, L"Ошибка", MessageBoxButtons::OK, MessageBoxIcon::Error);
-        }
-        catch (Exception^ ex) {
-            MessageBox::Show("Ошибка при клике по клетке: " + ex->Message, L"Ошибка", MessageBoxButtons::OK, MessageBoxIcon::Error);
-        }
-    }
 }
\ No newline at end of file
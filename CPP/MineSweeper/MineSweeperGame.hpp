@@ -1,10 +1,14 @@
 ﻿#pragma once
 
 #include "MineField.hpp"
+#include "MineSolver.hpp"
+#include "FieldViewport.hpp"
+#include "GameSnapshot.hpp"
 #include "GameTimer.hpp"
 #include "DifficultyManager.hpp"
 #include "InputHandler.hpp"
 #include "GameState.hpp"
+#include "StatisticsStore.hpp"
 
 namespace MineSweeper {
 
@@ -39,19 +43,53 @@ namespace MineSweeper {
         DifficultyManager* difficultyManager;
         InputHandler* inputHandler;
         GameState* gameState;
+        MineSolver* mineSolver;
+        StatisticsStore* statistics;
 
         // Элементы интерфейса (WinForms)
         Button^ buttonRestart;
         ComboBox^ comboBoxDifficulty;
+        CheckBox^ checkBoxNoGuess;
+        Button^ buttonHint;
         Label^ labelTimer;
         Panel^ gamePanel;
-        array<Button^, 2>^ cellButtons;
+        VScrollBar^ scrollRows;
+        HScrollBar^ scrollCols;
+        array<Button^>^ cellPool;
+
+        /// <summary>
+        /// Общий шрифт и цвета цифр для всех клеток пула
+        /// </summary>
+        Drawing::Font^ cellFont;
+        array<Color>^ numberColors;
+
+        /// <summary>
+        /// Минимальный размер клетки: поле крупнее панели прокручивается
+        /// </summary>
+        static const int MIN_CELL_SIZE = 24;
+
+        /// <summary>
+        /// Видимое окно поля: кнопка пула с номером slot показывает клетку этого слота
+        /// </summary>
+        FieldViewport* viewport;
 
         /// <summary>
         /// Флаг для предотвращения рекурсии при изменении сложности
         /// </summary>
         bool updatingDifficulty;
 
+        /// <summary>
+        /// Полосы прокрутки подстраиваются под окно: ValueChanged не должен двигать окно обратно
+        /// </summary>
+        bool syncingScroll;
+
+        /// <summary>
+        /// Первый ход ждёт фонового поиска поля без угадывания в клетке (pendingRow, pendingCol)
+        /// </summary>
+        bool generatingMines;
+        int pendingRow;
+        int pendingCol;
+
         /// <summary>
         /// Обязательная переменная конструктора - контейнер компонентов
         /// </summary>
@@ -67,15 +105,25 @@ namespace MineSweeper {
         /// </summary>
         System::Void InitializeComponent();
 
+        /// <summary>
+        /// Открывает журнал статистики игрока
+        /// </summary>
+        System::Void OpenStatistics();
+
         /// <summary>
         /// Инициализация игры
         /// </summary>
         System::Void InitializeGame();
 
         /// <summary>
-        /// Создает клетки на игровом поле
+        /// Создает постоянный пул кнопок клеток (один раз, по размеру панели)
         /// </summary>
         System::Void CreateCellButtons();
+
+        /// <summary>
+        /// Раскладывает пул под текущее поле; стоимость не зависит от размера поля
+        /// </summary>
+        System::Void LayoutCellButtons();
         System::Void cellButton_MouseDown(System::Object^ sender, System::Windows::Forms::MouseEventArgs^ e);
         System::Void cellButton_MouseUp(System::Object^ sender, System::Windows::Forms::MouseEventArgs^ e);
 
@@ -84,11 +132,50 @@ namespace MineSweeper {
         /// </summary>
         System::Void UpdateGameDisplay();
 
+        /// <summary>
+        /// Обновляет отображение одной клетки (если она видна)
+        /// </summary>
+        System::Void UpdateCellDisplay(int row, int col);
+
+        /// <summary>
+        /// Отрисовывает кнопку пула по состоянию её слота
+        /// </summary>
+        System::Void RenderSlot(int slot);
+
+        /// <summary>
+        /// Прокручивает видимую область так, чтобы клетка оказалась на экране
+        /// </summary>
+        System::Void EnsureCellVisible(int row, int col);
+
+        /// <summary>
+        /// Переводит координаты кнопки в координаты клетки поля
+        /// </summary>
+        Point GetCellOfButton(Button^ btn);
+
+        /// <summary>
+        /// Обрабатывает итог открытия клеток (OpenCell или Chord): поражение, разница для решателя, победа
+        /// </summary>
+        System::Void ProcessOpenResult(bool success, int row, int col);
+
+        /// <summary>
+        /// Запускает фоновую генерацию поля для первого хода: поле блокируется, время партии стоит
+        /// </summary>
+        System::Void BeginPendingOpen(int row, int col);
+
+        /// <summary>
+        /// Показывает ход генерации, а по готовности поля выполняет отложенный первый ход
+        /// </summary>
+        System::Void PollPendingOpen();
+
         // Обработчики событий интерфейса
         System::Void buttonRestart_Click(System::Object^ sender, System::EventArgs^ e);
         System::Void comboBoxDifficulty_SelectedIndexChanged(System::Object^ sender, System::EventArgs^ e);
+        System::Void checkBoxNoGuess_CheckedChanged(System::Object^ sender, System::EventArgs^ e);
+        System::Void buttonHint_Click(System::Object^ sender, System::EventArgs^ e);
+        System::Void MineSweeperForm_KeyDown(System::Object^ sender, System::Windows::Forms::KeyEventArgs^ e);
+        System::Void scrollField_ValueChanged(System::Object^ sender, System::EventArgs^ e);
         System::Void updateTimer_Tick(System::Object^ sender, System::EventArgs^ e);
-        System::Void cellButton_MouseClick(System::Object^ sender, System::Windows::Forms::MouseEventArgs^ e);
+        System::Void MineSweeperForm_Resize(System::Object^ sender, System::EventArgs^ e);
 
         /// <summary>
         /// Обновляет отображение таймера
@@ -100,6 +187,22 @@ namespace MineSweeper {
         /// </summary>
         System::Void HandleGameOver(GameState::GameStatus status);
 
+        /// <summary>
+        /// Отмена (Ctrl+Z) и повтор (Ctrl+Y) хода
+        /// </summary>
+        System::Void UndoMove();
+        System::Void RedoMove();
+
+        /// <summary>
+        /// Продолжает партию из автосохранения, если оно есть
+        /// </summary>
+        System::Void ResumeSavedGame();
+
+        /// <summary>
+        /// Сохраняет незаконченную партию при закрытии окна
+        /// </summary>
+        System::Void MineSweeperForm_FormClosing(System::Object^ sender, System::Windows::Forms::FormClosingEventArgs^ e);
+
         /// <summary>
         /// Преобразует std::string в System::String^
         /// </summary>
@@ -0,0 +1,484 @@
+﻿#include "MineField.hpp"
+#include "BoardGenerator.hpp"
+#include "MineSolver.hpp"
+#include "AutoPlayer.hpp"
+#include "GameSnapshot.hpp"
+#include "GameState.hpp"
+#include "GameTimer.hpp"
+#include "StatisticsStore.hpp"
+#include "GameCollection.hpp"
+#include "GameStatistics.hpp"
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Проверки движка "Сапёра" - отдельная консольная программа, как MineSweeperBenchmark.exe;
+// собирается из этого файла и исходников BoardGenerator, MineSolver, MineField, AutoPlayer,
+// DifficultyManager, GameSnapshot, MappedFile, GameState, GameTimer, EventHistory, StatisticsStore
+// и GameStatistics без WinForms. Пишет временные файлы в текущий каталог:
+//   MineSweeperTests.exe    - код возврата 0, если все проверки прошли, иначе число провалов
+using namespace MineSweeper;
+
+namespace {
+
+    int failures = 0;
+
+    void Check(bool condition, const std::string& what)
+    {
+        if (!condition)
+        {
+            std::cerr << "  ПРОВАЛ: " << what << std::endl;
+            failures++;
+        }
+    }
+
+    /// <summary>
+    /// Частичная перетасовка: ровно mines различных клеток вне excluded при любой плотности
+    /// </summary>
+    void TestPlacement()
+    {
+        const int cells = 200 * 200;
+        for (int percent : { 10, 50, 95 })
+        {
+            int mines = cells * percent / 100 - 9;
+            std::vector<int> excluded = BoardGenerator::GetSafeZone(200, 200, mines, 100, 100);
+            std::mt19937 random(7);
+            std::vector<int> sample = BoardGenerator::SampleMineCells(cells, mines, excluded, random);
+
+            std::set<int> unique(sample.begin(), sample.end());
+            bool inRange = !unique.empty() && *unique.begin() >= 0 && *unique.rbegin() < cells;
+            bool avoidsExcluded = true;
+            for (int cell : excluded)
+            {
+                avoidsExcluded = avoidsExcluded && unique.count(cell) == 0;
+            }
+            std::string name = std::to_string(percent) + "%: ";
+            Check((int)sample.size() == mines && (int)unique.size() == mines, name + "число различных мин");
+            Check(inRange && avoidsExcluded, name + "мины в пределах поля и вне исключённых клеток");
+
+            std::mt19937 again(7);
+            Check(BoardGenerator::SampleMineCells(cells, mines, excluded, again) == sample, name + "зерно воспроизводит расстановку");
+        }
+    }
+
+    /// <summary>
+    /// Первый ход безопасен вместе с окрестностью 3x3, мины расставляются только после него
+    /// </summary>
+    void TestFirstClickSafe()
+    {
+        MineField field(FieldSize{ 16, 30 }, 99, 11u, MineField::GenerationMode::FirstClickSafe);
+        Check(!field.AreMinesPlaced(), "мины не расставлены до первого хода");
+        Check(field.OpenCell(8, 15), "первый ход не подрывается");
+        int placed = 0;
+        for (int i = 0; i < field.GetRows(); i++)
+        {
+            for (int j = 0; j < field.GetCols(); j++)
+            {
+                placed += field.IsMine(i, j) ? 1 : 0;
+            }
+        }
+        bool zoneClear = true;
+        for (int i = 7; i <= 9; i++)
+        {
+            for (int j = 14; j <= 16; j++)
+            {
+                zoneClear = zoneClear && !field.IsMine(i, j);
+            }
+        }
+        Check(placed == 99 && zoneClear, "99 мин и пустая окрестность первого хода");
+    }
+
+    /// <summary>
+    /// Поле без угадывания проходится решателем; фоновый поиск не блокирует и отменяется
+    /// </summary>
+    void TestNoGuess()
+    {
+        std::mt19937 random(1);
+        int solvable = 0;
+        for (int i = 0; i < 10; i++)
+        {
+            BoardGenerator::Layout layout = BoardGenerator::GenerateNoGuess(9, 9, 10, 4, 4, random);
+            solvable += BoardGenerator::IsSolvableWithoutGuessing(layout, 9, 9, 4, 4) ? 1 : 0;
+        }
+        Check(solvable == 10, "9x9/10: все поля без угадывания проходятся");
+
+        MineField field(FieldSize{ 16, 16 }, 40, 3u, MineField::GenerationMode::NoGuess);
+        Check(field.BeginMinePlacement(5, 5), "фоновый поиск запускается");
+        while (field.IsGeneratingMines())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        Check(field.OpenCell(5, 5) && field.AreMinesPlaced(), "первый ход берёт найденную расстановку");
+
+        // Отмена: переинициализация поля не ждёт конца поиска
+        MineField large(FieldSize{ 30, 30 }, 200, 4u, MineField::GenerationMode::NoGuess);
+        large.BeginMinePlacement(0, 0);
+        auto start = std::chrono::steady_clock::now();
+        large.Initialize();
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        Check(!large.IsGeneratingMines() && milliseconds < 500.0, "отмена фонового поиска");
+    }
+
+    /// <summary>
+    /// Число мин вокруг клетки в плоской расстановке
+    /// </summary>
+    int CountAround(const std::vector<char>& layout, int rows, int cols, int cell)
+    {
+        int row = cell / cols;
+        int col = cell % cols;
+        int count = 0;
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                int r = row + dr;
+                int c = col + dc;
+                if ((dr != 0 || dc != 0) && r >= 0 && r < rows && c >= 0 && c < cols)
+                {
+                    count += layout[r * cols + c];
+                }
+            }
+        }
+        return count;
+    }
+
+    /// <summary>
+    /// Вероятности решателя совпадают с полным перебором расстановок на поле 4x5
+    /// </summary>
+    void TestSolverProbabilities()
+    {
+        const int rows = 4;
+        const int cols = 5;
+        const int cells = rows * cols;
+        std::mt19937 random(5);
+
+        for (int trial = 0; trial < 100; trial++)
+        {
+            int mines = 3 + trial % 6;
+            std::vector<char> layout(cells, 0);
+            for (int cell : BoardGenerator::SampleMineCells(cells, mines, {}, random))
+            {
+                layout[cell] = 1;
+            }
+
+            std::vector<int> revealed;
+            for (int cell = 0; cell < cells; cell++)
+            {
+                if (!layout[cell] && random() % 3 == 0)
+                {
+                    revealed.push_back(cell);
+                }
+            }
+
+            MineSolver solver(rows, cols, mines);
+            for (int cell : revealed)
+            {
+                solver.Reveal(cell / cols, cell % cols, CountAround(layout, rows, cols, cell));
+            }
+            solver.Solve();
+
+            // Перебор всех расстановок с тем же числом мин, согласных с открытыми числами
+            std::vector<double> mineCounts(cells, 0.0);
+            double total = 0.0;
+            std::vector<char> candidate(cells);
+            for (int mask = 0; mask < (1 << cells); mask++)
+            {
+                int bits = 0;
+                for (int i = 0; i < cells; i++)
+                {
+                    candidate[i] = (mask >> i) & 1;
+                    bits += candidate[i];
+                }
+                if (bits != mines)
+                {
+                    continue;
+                }
+                bool consistent = true;
+                for (size_t k = 0; k < revealed.size() && consistent; k++)
+                {
+                    int cell = revealed[k];
+                    consistent = !candidate[cell] && CountAround(candidate, rows, cols, cell) == CountAround(layout, rows, cols, cell);
+                }
+                if (!consistent)
+                {
+                    continue;
+                }
+                total += 1.0;
+                for (int i = 0; i < cells; i++)
+                {
+                    mineCounts[i] += candidate[i];
+                }
+            }
+
+            for (int cell = 0; cell < cells; cell++)
+            {
+                double expected = mineCounts[cell] / total;
+                if (std::fabs(solver.GetMineProbability(cell / cols, cell % cols) - expected) > 1e-9)
+                {
+                    Check(false, "вероятность решателя, опыт " + std::to_string(trial) + ", клетка " + std::to_string(cell));
+                    return;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Автоигрок проходит поля без угадывания, не угадывая; первый ход в отложенных режимах не считается угадыванием
+    /// </summary>
+    void TestAutoPlayer()
+    {
+        MineField field(FieldSize{ 16, 16 }, 40, 3u, MineField::GenerationMode::NoGuess);
+        AutoPlayer::GameResult result = AutoPlayer(field).Play();
+        Check(result.won && result.guesses == 0, "поле без угадывания пройдено без угадываний");
+
+        MineField open(FieldSize{ 9, 9 }, 1, 5u, MineField::GenerationMode::FirstClickSafe);
+        result = AutoPlayer(open).Play();
+        Check(result.won && result.guesses == 0, "безопасный первый ход не считается угадыванием");
+
+        DifficultyManager::DifficultySettings beginner = { "Новичок", 9, 9, 10, 0 };
+        BatchRunner::Report report = BatchRunner::Run(beginner, 200, MineField::GenerationMode::NoGuess, 2);
+        Check(report.games == 200 && report.wins == 200 && report.guesses.GetMax() == 0, "пакетный прогон без угадывания");
+    }
+
+    /// <summary>
+    /// Снимок партии восстанавливается без потерь, повреждённый снимок отвергается
+    /// </summary>
+    void TestSnapshot()
+    {
+        const std::string path = "MineSweeperTests.snapshot";
+        MineField field(FieldSize{ 9, 11 }, 20, 7u, MineField::GenerationMode::FirstClickSafe);
+        GameState state;
+        GameTimer timer(100);
+        state.StartNewGame();
+        timer.Start();
+        field.OpenCell(4, 4);
+        state.ProcessCellOpen(false, 4, 4);
+        field.ToggleFlag(0, 0);
+        GameSnapshot::Save(path, field, state, timer, 1);
+
+        MineField loaded(5, 3);
+        GameState loadedState;
+        GameTimer loadedTimer(1);
+        Check(GameSnapshot::Load(path, loaded, loadedState, loadedTimer) == 1, "уровень из снимка");
+        bool same = loaded.GetRows() == 9 && loaded.GetCols() == 11 && loaded.GetMinesCount() == 20;
+        for (int i = 0; i < 9 && same; i++)
+        {
+            for (int j = 0; j < 11 && same; j++)
+            {
+                same = loaded.IsMine(i, j) == field.IsMine(i, j) && loaded.IsOpened(i, j) == field.IsOpened(i, j)
+                    && loaded.IsFlagged(i, j) == field.IsFlagged(i, j);
+            }
+        }
+        Check(same, "поле из снимка совпадает с сохранённым");
+        Check(loadedState.GetHistory().GetCount() == state.GetHistory().GetCount(), "история из снимка");
+
+        // Сбрасываем одну мину в плоскости сразу за заголовком
+        std::vector<char> bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        for (size_t i = 56; i < bytes.size(); i++)
+        {
+            if (bytes[i] != 0)
+            {
+                bytes[i] &= bytes[i] - 1;
+                break;
+            }
+        }
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        bool rejected = false;
+        try
+        {
+            GameSnapshot::Load(path, loaded, loadedState, loadedTimer);
+        }
+        catch (const std::exception&)
+        {
+            rejected = true;
+        }
+        Check(rejected && loaded.GetRows() == 9, "повреждённый снимок отвергается без изменения поля");
+        GameSnapshot::Remove(path);
+    }
+
+    /// <summary>
+    /// Отмена и повтор хода восстанавливают поле и пишутся в историю партии
+    /// </summary>
+    void TestUndoRedo()
+    {
+        MineField field(FieldSize{ 9, 9 }, 10, 21u, MineField::GenerationMode::FirstClickSafe);
+        GameState state;
+        state.StartNewGame();
+
+        field.OpenCell(4, 4);
+        state.ProcessCellOpen(false, 4, 4);
+        std::vector<int> opened = field.GetLastOpenedCells();
+        Check(!opened.empty(), "первый ход открывает клетки");
+
+        size_t events = state.GetHistory().GetCount();
+        Check(field.Undo(), "ход отменяется");
+        state.ProcessUndo();
+        bool closed = true;
+        for (int cell : opened)
+        {
+            closed = closed && !field.IsOpened(cell / 9, cell % 9);
+        }
+        Check(closed && !field.CanUndo() && field.CanRedo(), "после отмены клетки закрыты");
+
+        Check(field.Redo(), "ход повторяется");
+        state.ProcessRedo();
+        Check(field.GetLastOpenedCells() == opened, "повтор открывает те же клетки");
+        Check(state.GetHistory().GetCount() == events + 2, "отмена и повтор записаны в историю");
+    }
+
+    /// <summary>
+    /// Журнал статистики переживает перезапуск, повреждённая запись пропускается
+    /// </summary>
+    void TestStatisticsStore()
+    {
+        const std::string path = "MineSweeperTests.stats";
+        std::remove(path.c_str());
+        const StatisticsStore::BoardKey beginner = { 9, 9, 10 };
+        const StatisticsStore::BoardKey expert = { 16, 30, 99 };
+        {
+            StatisticsStore store(path);
+            store.AddGameResult(true, 5000, beginner);
+            store.AddGameResult(false, 0, beginner);
+            store.AddGameResult(true, 9000, expert);
+
+            bool rejected = false;
+            try
+            {
+                store.AddGameResult(true, 1, { 0, 0, 0 });
+            }
+            catch (const std::out_of_range&)
+            {
+                rejected = true;
+            }
+            Check(rejected, "поле 0x0 не записывается");
+        }
+
+        {
+            StatisticsStore store(path);
+            Check(store.GetTotal().games == 3 && store.GetTotal().wins == 2, "итог после перезапуска");
+            Check(store.GetByBoard(beginner).games == 2 && store.GetByBoard(expert).GetBestTime() == 9000, "показатели по полям");
+        }
+
+        // Портим число строк второй записи: заголовок 16 байт, запись 32
+        {
+            std::fstream io(path, std::ios::in | std::ios::out | std::ios::binary);
+            io.seekp(16 + 32 + 12);
+            int bad = -5;
+            io.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+        }
+        StatisticsStore store(path);
+        Check(store.GetSkippedRecords() == 1 && store.GetTotal().games == 2, "повреждённая запись пропущена, остальные целы");
+        std::remove(path.c_str());
+    }
+
+    /// <summary>
+    /// Коллекция: имя уникально, переименование поддерживает индексы, сборка по частям
+    /// </summary>
+    void TestGameCollection()
+    {
+        struct Item
+        {
+            std::string name;
+            int score;
+            std::string GetName() const { return name; }
+            int GetScore() const { return score; }
+        };
+        using Collection = GameCollection<Item>;
+
+        Collection collection;
+        Check(collection.Add(std::make_unique<Item>(Item{ "a", 1 })), "добавление");
+        Check(!collection.Add(std::make_unique<Item>(Item{ "a", 9 })) && collection.FindByName("a")->score == 1,
+            "Add не заменяет элемент с тем же именем");
+        collection.AddOrReplace(std::make_unique<Item>(Item{ "a", 5 }));
+        Check(collection.FindByName("a")->score == 5, "AddOrReplace заменяет");
+
+        collection.Add(std::make_unique<Item>(Item{ "b", 2 }));
+        collection.Add(std::make_unique<Item>(Item{ "c", 3 }));
+        Check(collection.Modify("a", [](Item& item) { item.name = "z"; item.score = 0; }), "переименование");
+        Check(!collection.FindByName("a") && collection.FindByName("z") && collection.GetTop(1)[0]->name == "c",
+            "индексы имени и счёта после переименования");
+        Check(collection.Modify("c", [](Item& item) { item.name = "b"; item.score = 7; })
+            && collection.Size() == 2 && collection.FindByName("b")->score == 7, "переименование на занятое имя заменяет элемент");
+        Check(collection.Remove("b") && collection.Size() == 1, "удаление");
+
+        std::vector<std::vector<std::unique_ptr<Item>>> shards(64);
+        for (int i = 0; i < 64000; i++)
+        {
+            shards[i % 64].push_back(std::make_unique<Item>(Item{ std::to_string(i % 5000), i }));
+        }
+        Collection built = Collection::BuildParallel(std::move(shards));
+        Check(built.Size() == 5000 && built.GetTop(1)[0]->score == 63999, "параллельная сборка: последнее имя побеждает");
+    }
+
+    void TestSharedHistory()
+    {
+        SharedHistory<int> original;
+        Check(original.Empty(), "пустая история");
+        original.PushBack(1);
+        original.PushBack(2);
+
+        SharedHistory<int> copy = original;
+        Check(&copy.Get() == &original.Get(), "копия разделяет буфер");
+        copy.PushBack(3);
+        Check(&copy.Get() != &original.Get(), "первая запись отделяет копию");
+        Check(original.Size() == 2 && copy.Size() == 3 && copy.Back() == 3, "оригинал не изменился");
+
+        const std::vector<int>* buffer = &copy.Get();
+        copy.PushBack(4);
+        Check(&copy.Get() == buffer, "единственный владелец пишет на месте");
+
+        ExtendedStatistics stats("Player");
+        stats.AddGameResult(true, 1000);
+        std::unique_ptr<ExtendedStatistics> clone(stats.Clone());
+        clone->AddGameResult(false);
+        Check(stats.GetDetailedReport().find("Game results recorded: 1") != std::string::npos &&
+            clone->GetDetailedReport().find("Game results recorded: 2") != std::string::npos,
+            "клон статистики отделяется при первой записи");
+    }
+
+    void Run(const char* name, void (*test)())
+    {
+        int before = failures;
+        auto start = std::chrono::steady_clock::now();
+        test();
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (failures == before ? "[ ok ] " : "[FAIL] ") << name << " (" << (long long)milliseconds << " мс)" << std::endl;
+    }
+}
+
+int main() {
+
+    // Устанавливаем локаль для поддержки русского языка
+    setlocale(LC_ALL, "Russian");
+
+    Run("расстановка мин", TestPlacement);
+    Run("первый ход", TestFirstClickSafe);
+    Run("поле без угадывания", TestNoGuess);
+    Run("вероятности решателя", TestSolverProbabilities);
+    Run("автоигрок", TestAutoPlayer);
+    Run("снимок партии", TestSnapshot);
+    Run("отмена и повтор", TestUndoRedo);
+    Run("журнал статистики", TestStatisticsStore);
+    Run("коллекция игр", TestGameCollection);
+    Run("общая история", TestSharedHistory);
+
+    std::cout << (failures == 0 ? "Все проверки прошли" : "Провалено проверок: " + std::to_string(failures)) << std::endl;
+    return failures;
+}
\ No newline at end of file
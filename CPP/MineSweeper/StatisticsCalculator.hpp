@@ -5,57 +5,40 @@
 #include <algorithm>
 #include <vector>
 #include <cmath>
+#include "../StreamingStatistics.hpp"
 
 // ВНЕ пространства имен MineSweeper, в глобальном пространстве имен
+template<typename ValueType>
+struct StatisticsResult {
+    ValueType min;
+    ValueType max;
+    double average;
+    double median;
+    double standardDeviation;
+};
+
+// Один проход потоковым накопителем; медиана ищется nth_element без сортировки копии
 template<typename Container, typename ValueType = typename Container::value_type>
 auto CalculateStatistics(const Container& data)
 -> typename std::enable_if<std::is_arithmetic<ValueType>::value,
-    struct StatisticsResult>::type {
+    StatisticsResult<ValueType>>::type {
 
-    struct StatisticsResult {
-        ValueType min;
-        ValueType max;
-        double average;
-        double median;
-        double standardDeviation;
-    };
-
-    StatisticsResult result{};
-
-    if (data.empty()) {
-        return result;
-    }
-
-    // Минимальное значение (алгоритм поиска)
-    result.min = *std::min_element(data.begin(), data.end());
-
-    // Максимальное значение (алгоритм поиска)
-    result.max = *std::max_element(data.begin(), data.end());
-
-    // Среднее значение
-    double sum = std::accumulate(data.begin(), data.end(), 0.0);
-    result.average = sum / data.size();
-
-    // Медиана
-    std::vector<ValueType> sortedData(data.begin(), data.end());
-    std::sort(sortedData.begin(), sortedData.end());
-
-    size_t size = sortedData.size();
-    if (size % 2 == 0) {
-        result.median = (sortedData[size / 2 - 1] + sortedData[size / 2]) / 2.0;
-    }
-    else {
-        result.median = sortedData[size / 2];
+    using Accumulator = GameLauncher::StreamingStatistics<ValueType>;
+    Accumulator stats(Accumulator::QuantileMode::Exact);
+    for (const auto& value : data) {
+        stats.Add(value);
     }
 
-    // Стандартное отклонение
-    double variance = 0.0;
-    for (const auto& value : data) {
-        variance += std::pow(value - result.average, 2);
+    StatisticsResult<ValueType> result{};
+    if (stats.IsEmpty()) {
+        return result;
     }
-    variance /= data.size();
-    result.standardDeviation = std::sqrt(variance);
 
+    result.min = stats.GetMin();
+    result.max = stats.GetMax();
+    result.average = stats.GetMean();
+    result.median = stats.GetMedian();
+    result.standardDeviation = stats.GetStandardDeviation();
     return result;
 }
 
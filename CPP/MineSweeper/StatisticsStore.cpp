@@ -0,0 +1,190 @@
+﻿#include "StatisticsStore.hpp"
+#include "MappedFile.hpp"
+#include "MineField.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace MineSweeper {
+
+    namespace {
+        const char STATISTICS_MAGIC[4] = { 'M', 'S', 'S', 'T' };
+    }
+
+    void StatisticsStore::Aggregate::Add(bool won, int timeMilliseconds)
+    {
+        games++;
+        if (!won) return;
+
+        wins++;
+        if (timeMilliseconds > 0) {
+            times.Add(timeMilliseconds);
+        }
+    }
+
+    double StatisticsStore::Aggregate::GetTimeStandardDeviation() const
+    {
+        return std::sqrt(times.GetSampleVariance());
+    }
+
+    bool StatisticsStore::BoardKey::operator<(const BoardKey& other) const
+    {
+        if (rows != other.rows) return rows < other.rows;
+        if (cols != other.cols) return cols < other.cols;
+        return mines < other.mines;
+    }
+
+    bool StatisticsStore::IsValidBoard(const BoardKey& board)
+    {
+        return board.rows > 0 && board.cols > 0 &&
+            static_cast<long long>(board.rows) * board.cols <= MineField::MAX_CELLS &&
+            board.mines >= 0 && board.mines < board.rows * board.cols;
+    }
+
+    std::string StatisticsStore::GetDefaultPath(const std::string& playerName)
+    {
+        std::string name = playerName.empty() ? "Player" : playerName;
+        for (char& c : name) {
+            unsigned char code = static_cast<unsigned char>(c);
+            if (!(std::isalnum(code) || c == '_' || c == '-')) {
+                c = '_';
+            }
+        }
+        return std::string(DEFAULT_FILE_PREFIX) + name + ".log";
+    }
+
+    StatisticsStore::StatisticsStore(const std::string& path)
+        : path(path)
+    {
+        Load();
+    }
+
+    void StatisticsStore::Load()
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(path, error) || std::filesystem::file_size(path, error) == 0) {
+            return;
+        }
+
+        size_t validSize;
+        size_t fileSize;
+        {
+            MappedFile file(path);
+            const unsigned char* data = file.GetData();
+            fileSize = file.GetSize();
+
+            FileHeader header;
+            if (fileSize < sizeof(FileHeader)) {
+                throw std::invalid_argument("Statistics file is truncated");
+            }
+            std::memcpy(&header, data, sizeof(header));
+            if (std::memcmp(header.magic, STATISTICS_MAGIC, sizeof(header.magic)) != 0) {
+                throw std::invalid_argument("Not a MineSweeper statistics file");
+            }
+            if (header.version != FORMAT_VERSION || header.recordSize != sizeof(Record)) {
+                throw std::invalid_argument("Unsupported statistics file version");
+            }
+
+            const size_t recordsCount = (fileSize - sizeof(FileHeader)) / sizeof(Record);
+            const unsigned char* records = data + sizeof(FileHeader);
+            for (size_t i = 0; i < recordsCount; i++) {
+                Record record;
+                std::memcpy(&record, records + i * sizeof(Record), sizeof(record));
+
+                // Одна испорченная запись не должна лишать игрока всей статистики
+                if (!IsValidBoard({ record.rows, record.cols, record.mines }) ||
+                    record.won > 1 || record.timeMilliseconds < 0) {
+                    skippedRecords++;
+                    continue;
+                }
+                Apply(record);
+            }
+            validSize = sizeof(FileHeader) + recordsCount * sizeof(Record);
+        }
+
+        // Запись, оборванная при сбое, отрезается, иначе следующие легли бы со сдвигом
+        if (validSize != fileSize) {
+            std::filesystem::resize_file(path, validSize);
+        }
+    }
+
+    void StatisticsStore::Apply(const Record& record)
+    {
+        bool won = record.won != 0;
+        total.Add(won, record.timeMilliseconds);
+        byBoard[{ record.rows, record.cols, record.mines }].Add(won, record.timeMilliseconds);
+    }
+
+    void StatisticsStore::AddGameResult(bool won, int timeMilliseconds, const BoardKey& board)
+    {
+        if (!IsValidBoard(board)) {
+            throw std::out_of_range("Invalid board size");
+        }
+
+        Record record = {};
+        record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        record.timeMilliseconds = std::max(0, timeMilliseconds);
+        record.rows = board.rows;
+        record.cols = board.cols;
+        record.mines = board.mines;
+        record.won = won ? 1 : 0;
+
+        std::error_code error;
+        bool isNew = !std::filesystem::exists(path, error) || std::filesystem::file_size(path, error) == 0;
+
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        if (isNew) {
+            FileHeader header = {};
+            std::memcpy(header.magic, STATISTICS_MAGIC, sizeof(header.magic));
+            header.version = FORMAT_VERSION;
+            header.recordSize = sizeof(Record);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        file.flush();
+        if (!file) {
+            throw std::runtime_error("Cannot write statistics file");
+        }
+
+        Apply(record);
+    }
+
+    const StatisticsStore::Aggregate& StatisticsStore::GetByBoard(const BoardKey& board) const
+    {
+        auto it = byBoard.find(board);
+        return it != byBoard.end() ? it->second : empty;
+    }
+
+    std::string StatisticsStore::GetSummary() const
+    {
+        return FormatSummary(total);
+    }
+
+    std::string StatisticsStore::GetSummary(const BoardKey& board) const
+    {
+        return FormatSummary(GetByBoard(board));
+    }
+
+    std::string StatisticsStore::FormatSummary(const Aggregate& aggregate)
+    {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(3)
+            << "Games: " << aggregate.games
+            << ", Won: " << aggregate.wins
+            << ", Win Rate: " << aggregate.GetWinRate() * 100 << "%"
+            << ", Best Time: " << aggregate.GetBestTime() / 1000.0 << "s"
+            << ", Avg Time: " << aggregate.GetMeanTime() / 1000.0 << "s"
+            << " (+/- " << aggregate.GetTimeStandardDeviation() / 1000.0 << "s)"
+            << ", Median: " << aggregate.GetTimePercentile(0.5) / 1000.0 << "s"
+            << ", P90: " << aggregate.GetTimePercentile(0.9) / 1000.0 << "s";
+        return oss.str();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include "../StreamingStatistics.hpp"
+
+namespace MineSweeper {
+
+    /// <summary>
+    /// Постоянная статистика игрока: журнал партий на диске, в который только дописывают,
+    /// и агрегаты в памяти (общие и по каждому полю), обновляемые за O(log n) на партию.
+    /// При создании журнал читается одним отображением файла в память,
+    /// поэтому даже многолетняя история загружается за один проход
+    /// </summary>
+    class StatisticsStore
+    {
+    public:
+        // Журналы игроков лежат рядом с программой: <префикс><имя игрока>.log
+        static constexpr const char* DEFAULT_FILE_PREFIX = "MineSweeperStats_";
+
+        /// <summary>
+        /// Сводные показатели по набору партий. Время учитывается только у побед, в миллисекундах
+        /// </summary>
+        struct Aggregate
+        {
+            using TimeStatistics = GameLauncher::StreamingStatistics<int>;
+
+            long long games = 0;
+            long long wins = 0;
+            TimeStatistics times{ TimeStatistics::QuantileMode::Sketch };
+
+            void Add(bool won, int timeMilliseconds);
+
+            double GetWinRate() const { return games > 0 ? static_cast<double>(wins) / games : 0.0; }
+
+            /// <summary>
+            /// Лучшее время; 0 - побед со временем ещё нет
+            /// </summary>
+            int GetBestTime() const { return times.IsEmpty() ? 0 : times.GetMin(); }
+            double GetMeanTime() const { return times.GetMean(); }
+            double GetTimeStandardDeviation() const;
+
+            /// <summary>
+            /// Квантиль времени побед (0.5 - медиана) по эскизу, без сортировки
+            /// </summary>
+            double GetTimePercentile(double q) const { return times.GetQuantile(q); }
+        };
+
+        /// <summary>
+        /// Поле, по которому группируются партии. Пресеты сложности можно править и переставлять,
+        /// поэтому ключ - размеры и число мин, а не номер или имя уровня
+        /// </summary>
+        struct BoardKey
+        {
+            int rows;
+            int cols;
+            int mines;
+
+            bool operator<(const BoardKey& other) const;
+        };
+
+        /// <summary>
+        /// Путь журнала игрока; символы, недопустимые в имени файла, заменяются на '_'
+        /// </summary>
+        static std::string GetDefaultPath(const std::string& playerName);
+
+        /// <summary>
+        /// Открывает журнал (отсутствующий файл - пустая статистика) и восстанавливает агрегаты.
+        /// Повреждённый заголовок - invalid_argument; повреждённые записи пропускаются
+        /// (см. GetSkippedRecords), оборванная последняя запись отбрасывается
+        /// </summary>
+        explicit StatisticsStore(const std::string& path);
+
+        /// <summary>
+        /// Дописывает партию на поле board в журнал и обновляет агрегаты.
+        /// Недопустимое поле - out_of_range
+        /// </summary>
+        void AddGameResult(bool won, int timeMilliseconds, const BoardKey& board);
+
+        const Aggregate& GetTotal() const { return total; }
+
+        /// <summary>
+        /// Показатели одного поля (пустые, если партий на нём не было)
+        /// </summary>
+        const Aggregate& GetByBoard(const BoardKey& board) const;
+
+        /// <summary>
+        /// Краткая сводка по всем партиям
+        /// </summary>
+        std::string GetSummary() const;
+
+        /// <summary>
+        /// Краткая сводка по одному полю
+        /// </summary>
+        std::string GetSummary(const BoardKey& board) const;
+
+        /// <summary>
+        /// Сколько повреждённых записей пропущено при загрузке журнала
+        /// </summary>
+        long long GetSkippedRecords() const { return skippedRecords; }
+
+        const std::string& GetPath() const { return path; }
+
+    private:
+        struct FileHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t recordSize;
+            uint32_t reserved;
+        };
+        static_assert(sizeof(FileHeader) == 16, "Statistics header layout changed");
+
+        struct Record
+        {
+            int64_t timestamp;       // Миллисекунды с начала эпохи
+            int32_t timeMilliseconds;
+            int32_t rows;
+            int32_t cols;
+            int32_t mines;
+            uint8_t won;
+            uint8_t reserved[7];
+        };
+        static_assert(sizeof(Record) == 32, "Statistics record layout changed");
+
+        static const uint32_t FORMAT_VERSION = 1;
+
+        std::string path;
+        Aggregate total;
+        std::map<BoardKey, Aggregate> byBoard;
+        Aggregate empty;
+        long long skippedRecords = 0;
+
+        void Load();
+        void Apply(const Record& record);
+        static bool IsValidBoard(const BoardKey& board);
+        static std::string FormatSummary(const Aggregate& aggregate);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace GameLauncher {
+
+    /// <summary>
+    /// Компактный эскиз распределения для квантилей без хранения и сортировки значений.
+    /// Значения раскладываются по логарифмическим корзинам: оценка любого квантиля
+    /// отличается от точной не больше чем на relativeAccuracy (относительно),
+    /// а память зависит только от разброса значений, а не от их числа.
+    /// Эскизы с одинаковой точностью складываются.
+    /// Класс целиком в заголовке, чтобы StreamingStatistics не требовал отдельной единицы трансляции
+    /// </summary>
+    class QuantileSketch
+    {
+    public:
+        /// <summary>
+        /// relativeAccuracy вне (0, 1) - invalid_argument
+        /// </summary>
+        explicit QuantileSketch(double relativeAccuracy = 0.01);
+
+        /// <summary>
+        /// Добавляет неотрицательное значение; отрицательное - invalid_argument
+        /// (логарифмические корзины определены только для value >= 0)
+        /// </summary>
+        void Add(double value);
+
+        /// <summary>
+        /// Добавляет все значения другого эскиза той же точности
+        /// </summary>
+        void Merge(const QuantileSketch& other);
+
+        /// <summary>
+        /// Оценка квантиля q из [0, 1]; 0 для пустого эскиза. Эскиз не изменяется,
+        /// поэтому одновременное чтение из нескольких потоков безопасно
+        /// </summary>
+        double GetQuantile(double q) const;
+
+        long long GetCount() const { return count; }
+        double GetRelativeAccuracy() const { return relativeAccuracy; }
+
+        void Clear();
+
+    private:
+        // Меньшие значения попадают в отдельный счётчик нулей
+        static constexpr double MIN_VALUE = 1e-9;
+
+        double relativeAccuracy;
+        double gamma;
+        double logGamma;
+        long long count;
+        long long zeroCount;       // Значения, слишком близкие к нулю для логарифма
+        int minIndex;              // Номер корзины buckets[0]
+        std::vector<long long> buckets;
+
+        int IndexOf(double value) const;
+        double ValueOf(int index) const;
+    };
+
+    inline QuantileSketch::QuantileSketch(double relativeAccuracy)
+        : relativeAccuracy(relativeAccuracy), count(0), zeroCount(0), minIndex(0)
+    {
+        if (!(relativeAccuracy > 0.0 && relativeAccuracy < 1.0)) {
+            throw std::invalid_argument("Relative accuracy must be in (0, 1)");
+        }
+        gamma = (1.0 + relativeAccuracy) / (1.0 - relativeAccuracy);
+        logGamma = std::log(gamma);
+    }
+
+    inline int QuantileSketch::IndexOf(double value) const
+    {
+        return static_cast<int>(std::ceil(std::log(value) / logGamma));
+    }
+
+    inline double QuantileSketch::ValueOf(int index) const
+    {
+        // Середина корзины (gamma^(i-1), gamma^i] с относительной ошибкой не больше relativeAccuracy
+        return 2.0 * std::pow(gamma, index) / (gamma + 1.0);
+    }
+
+    inline void QuantileSketch::Add(double value)
+    {
+        if (value < 0.0) {
+            throw std::invalid_argument("Sketch values must be non-negative");
+        }
+
+        count++;
+        if (value < MIN_VALUE) {
+            zeroCount++;
+            return;
+        }
+
+        int index = IndexOf(value);
+        if (buckets.empty()) {
+            minIndex = index;
+            buckets.push_back(0);
+        }
+        else if (index < minIndex) {
+            buckets.insert(buckets.begin(), static_cast<size_t>(minIndex - index), 0);
+            minIndex = index;
+        }
+        else if (index - minIndex >= static_cast<int>(buckets.size())) {
+            buckets.resize(static_cast<size_t>(index - minIndex) + 1, 0);
+        }
+        buckets[index - minIndex]++;
+    }
+
+    inline void QuantileSketch::Merge(const QuantileSketch& other)
+    {
+        if (other.gamma != gamma) {
+            throw std::invalid_argument("Cannot merge sketches with different accuracy");
+        }
+        if (other.buckets.empty()) {
+            count += other.count;
+            zeroCount += other.zeroCount;
+            return;
+        }
+
+        if (buckets.empty()) {
+            minIndex = other.minIndex;
+        }
+        int newMin = std::min(minIndex, other.minIndex);
+        int newMax = std::max(minIndex + static_cast<int>(buckets.size()),
+            other.minIndex + static_cast<int>(other.buckets.size()));
+
+        std::vector<long long> merged(static_cast<size_t>(newMax - newMin), 0);
+        for (size_t i = 0; i < buckets.size(); i++) {
+            merged[minIndex - newMin + i] += buckets[i];
+        }
+        for (size_t i = 0; i < other.buckets.size(); i++) {
+            merged[other.minIndex - newMin + i] += other.buckets[i];
+        }
+
+        buckets.swap(merged);
+        minIndex = newMin;
+        count += other.count;
+        zeroCount += other.zeroCount;
+    }
+
+    inline double QuantileSketch::GetQuantile(double q) const
+    {
+        if (count == 0) return 0.0;
+
+        q = std::clamp(q, 0.0, 1.0);
+        const long long rank = static_cast<long long>(q * (count - 1));
+        if (rank < zeroCount) return 0.0;
+
+        long long seen = zeroCount;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            seen += buckets[i];
+            if (seen > rank) {
+                return ValueOf(minIndex + static_cast<int>(i));
+            }
+        }
+        return ValueOf(minIndex + static_cast<int>(buckets.size()) - 1);
+    }
+
+    inline void QuantileSketch::Clear()
+    {
+        count = 0;
+        zeroCount = 0;
+        minIndex = 0;
+        buckets.clear();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "QuantileSketch.hpp"
+
+namespace GameLauncher {
+
+    /// <summary>
+    /// Потоковый подсчёт статистики за один проход: количество, сумма, минимум, максимум,
+    /// среднее и дисперсия по Уэлфорду. Квантили считаются выбранным способом:
+    /// точно (значения сохраняются, квантиль ищется nth_element без полной сортировки)
+    /// или по эскизу QuantileSketch с фиксированной относительной точностью
+    /// (эскиз создаётся только в режиме Sketch; его значения должны быть неотрицательными).
+    /// Частичные результаты (например, посчитанные в разных потоках) объединяются через Merge
+    /// </summary>
+    template<typename T>
+    class StreamingStatistics
+    {
+        static_assert(std::is_arithmetic<T>::value, "StreamingStatistics requires an arithmetic type");
+
+    public:
+        using SumType = typename std::conditional<std::is_integral<T>::value, long long, double>::type;
+
+        /// <summary>
+        /// Способ оценки квантилей
+        /// </summary>
+        enum class QuantileMode
+        {
+            None,    // Квантили не нужны: память O(1)
+            Exact,   // Точные квантили: значения хранятся
+            Sketch   // Приближённые квантили: логарифмические корзины эскиза
+        };
+
+        explicit StreamingStatistics(QuantileMode mode = QuantileMode::None, double sketchAccuracy = 0.01)
+            : mode(mode), count(0), sum(0), minimum(T()), maximum(T()), mean(0.0), m2(0.0)
+        {
+            if (mode == QuantileMode::Sketch) {
+                sketch.emplace(sketchAccuracy);
+            }
+        }
+
+        /// <summary>
+        /// Добавляет значение. В режиме Sketch отрицательное значение - invalid_argument
+        /// от QuantileSketch::Add, и накопитель при этом не меняется
+        /// </summary>
+        void Add(T value)
+        {
+            if (mode == QuantileMode::Sketch) {
+                sketch->Add(static_cast<double>(value));
+            }
+
+            if (count == 0 || value < minimum) minimum = value;
+            if (count == 0 || value > maximum) maximum = value;
+            count++;
+            sum += static_cast<SumType>(value);
+
+            double delta = static_cast<double>(value) - mean;
+            mean += delta / count;
+            m2 += delta * (static_cast<double>(value) - mean);
+
+            if (mode == QuantileMode::Exact) {
+                values.push_back(value);
+            }
+        }
+
+        /// <summary>
+        /// Добавляет частичный результат с тем же способом оценки квантилей
+        /// </summary>
+        void Merge(const StreamingStatistics& other)
+        {
+            if (other.mode != mode) {
+                throw std::invalid_argument("Cannot merge statistics with different quantile modes");
+            }
+            if (other.count == 0) return;
+            if (count == 0) {
+                *this = other;
+                return;
+            }
+
+            // Объединение средних и M2 по Чану: без повторного прохода по данным
+            long long total = count + other.count;
+            double delta = other.mean - mean;
+            mean += delta * other.count / total;
+            m2 += other.m2 + delta * delta * (static_cast<double>(count) * other.count / total);
+            count = total;
+            sum += other.sum;
+            minimum = std::min(minimum, other.minimum);
+            maximum = std::max(maximum, other.maximum);
+
+            if (mode == QuantileMode::Exact) {
+                values.insert(values.end(), other.values.begin(), other.values.end());
+            }
+            else if (mode == QuantileMode::Sketch) {
+                sketch->Merge(*other.sketch);
+            }
+        }
+
+        void Clear()
+        {
+            *this = sketch ? StreamingStatistics(mode, sketch->GetRelativeAccuracy()) : StreamingStatistics(mode);
+        }
+
+        long long GetCount() const { return count; }
+        bool IsEmpty() const { return count == 0; }
+        SumType GetSum() const { return sum; }
+        T GetMin() const { return minimum; }
+        T GetMax() const { return maximum; }
+        double GetMean() const { return mean; }
+        QuantileMode GetQuantileMode() const { return mode; }
+
+        /// <summary>
+        /// Дисперсия генеральной совокупности (деление на n) и выборочная (на n - 1)
+        /// </summary>
+        double GetVariance() const { return count > 0 ? m2 / count : 0.0; }
+        double GetSampleVariance() const { return count > 1 ? m2 / (count - 1) : 0.0; }
+        double GetStandardDeviation() const { return std::sqrt(GetVariance()); }
+
+        /// <summary>
+        /// Квантиль q из [0, 1] с линейной интерполяцией между соседними значениями
+        /// (для чётного числа значений медиана - среднее двух средних).
+        /// В режиме None - logic_error.
+        /// В режиме Exact метод переупорядочивает сохранённые значения (nth_element), поэтому
+        /// одновременные вызовы из нескольких потоков даже на константном объекте небезопасны;
+        /// в режиме Sketch чтение не меняет состояние
+        /// </summary>
+        double GetQuantile(double q) const
+        {
+            if (count == 0) return 0.0;
+            q = std::clamp(q, 0.0, 1.0);
+
+            switch (mode)
+            {
+            case QuantileMode::Exact:
+            {
+                double position = q * (values.size() - 1);
+                size_t index = static_cast<size_t>(position);
+                double fraction = position - index;
+
+                // Частичное упорядочивание: O(n) в среднем вместо сортировки копии
+                std::nth_element(values.begin(), values.begin() + index, values.end());
+                double lower = static_cast<double>(values[index]);
+                if (fraction == 0.0 || index + 1 >= values.size()) {
+                    return lower;
+                }
+                double upper = static_cast<double>(*std::min_element(values.begin() + index + 1, values.end()));
+                return lower + fraction * (upper - lower);
+            }
+            case QuantileMode::Sketch:
+                return sketch->GetQuantile(q);
+            default:
+                throw std::logic_error("Quantiles are not tracked by this accumulator");
+            }
+        }
+
+        double GetMedian() const { return GetQuantile(0.5); }
+
+    private:
+        QuantileMode mode;
+        long long count;
+        SumType sum;
+        T minimum;
+        T maximum;
+        double mean;
+        double m2;
+        mutable std::vector<T> values;         // Только в режиме Exact; GetQuantile переупорядочивает
+        std::optional<QuantileSketch> sketch;  // Только в режиме Sketch
+    };
+}
\ No newline at end of file